@@ -0,0 +1,107 @@
+#include <simucore/Simulation.hpp>
+#include <simucore/SpatialGrid.hpp>
+#include <simucore/SweepAndPrune.hpp>
+#include <simucore/DynamicTree.hpp>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+
+
+int NB_STEPS = 10000; // number of simulation steps to run
+int NB_PLANETS = 5; // initial number of planets
+unsigned int SEED = 0; // random seed, 0 means seeded from the current time
+double STEP_DURATION = 1.0 / 60.0; // simulated time between two steps (in seconds)
+std::string BROAD_PHASE = "bvh"; // broad phase of the collision detection: grid, sap, bvh or brute
+int NB_THREADS = 0; // number of threads of the narrow phase, 0 means every hardware thread
+
+/* Run the simulation without any window and report its throughput */
+void simucollisionHeadless();
+
+
+/* Print the available options */
+void usage(const char* name) {
+    std::cerr << "Usage: " << name << " [options]" << std::endl
+              << "  --steps N        number of simulation steps (default " << NB_STEPS << ")" << std::endl
+              << "  --planets N      initial number of planets (default " << NB_PLANETS << ")" << std::endl
+              << "  --seed N         random seed, 0 to use the current time (default " << SEED << ")" << std::endl
+              << "  --dt X           simulated time of one step in seconds (default " << STEP_DURATION << ")" << std::endl
+              << "  --broadphase B   collision broad phase: grid, sap, bvh or brute (default " << BROAD_PHASE << ")" << std::endl
+              << "  --threads N      threads of the narrow phase, 0 for every hardware thread (default " << NB_THREADS << ")" << std::endl;
+}
+
+
+int main(int argc, char** argv) {
+    for(int i=1; i<argc; i++) {
+        if(i + 1 >= argc) { usage(argv[0]); return -1; }
+        if(strcmp(argv[i], "--steps") == 0) NB_STEPS = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--planets") == 0) NB_PLANETS = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--seed") == 0) SEED = (unsigned int)atoi(argv[++i]);
+        else if(strcmp(argv[i], "--dt") == 0) STEP_DURATION = atof(argv[++i]);
+        else if(strcmp(argv[i], "--broadphase") == 0) BROAD_PHASE = argv[++i];
+        else if(strcmp(argv[i], "--threads") == 0) NB_THREADS = atoi(argv[++i]);
+        else { usage(argv[0]); return -1; }
+    }
+    if(NB_STEPS <= 0 || NB_PLANETS < 0 || STEP_DURATION <= 0.0 || NB_THREADS < 0 || (BROAD_PHASE != "grid" && BROAD_PHASE != "sap" && BROAD_PHASE != "bvh" && BROAD_PHASE != "brute")) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    std::cout << "Launching headless simulation..." << std::endl;
+    std::cout << "Steps = " << NB_STEPS << ", initial number of planets = " << NB_PLANETS
+              << ", step duration = " << STEP_DURATION << "s, broad phase = " << BROAD_PHASE << ", threads = " << NB_THREADS
+              << ", c3ga instruction set = " << c3ga::batch::isaName(c3ga::batch::selectedIsa()) << "." << std::endl;
+
+    simucollisionHeadless();
+    return 0;
+}
+
+
+void simucollisionHeadless() {
+    VirtualClock clock;
+    Info info(&clock);
+    info.setSeed(SEED == 0 ? time(0) : SEED);
+    info.modifyLogEvents(); // no output during the run, it would be measured too
+    SpatialGrid grid;
+    SweepAndPrune sweepAndPrune;
+    DynamicTree dynamicTree;
+    BruteForce bruteForce;
+    BroadPhase* broadPhase = &bruteForce;
+    if(BROAD_PHASE == "grid") broadPhase = &grid;
+    else if(BROAD_PHASE == "sap") broadPhase = &sweepAndPrune;
+    else if(BROAD_PHASE == "bvh") broadPhase = &dynamicTree;
+    NarrowPhase narrowPhase(NB_THREADS);
+
+    PlanetSystem planets = createAllPlanets(NB_PLANETS, &info);
+    ParticleSystem explosions; // explosion particles
+    UpdateBuffers buffers; // working arrays of the update, kept between the steps
+    long long nbCollisions = 0;
+    size_t peakPlanets = planets.size();
+    size_t peakExplosions = 0;
+    size_t peakBodies = planets.size();
+
+    auto start = std::chrono::steady_clock::now();
+    for(int step=0; step<NB_STEPS; step++) { // main loop, as fast as possible
+        updateVisibility(&planets, info);
+        nbCollisions += updateEverything(&planets, &explosions, &info, broadPhase, &narrowPhase, &buffers);
+        clock.advance(STEP_DURATION);
+        if(planets.size() > peakPlanets) peakPlanets = planets.size();
+        if(explosions.size() > peakExplosions) peakExplosions = explosions.size();
+        if(planets.size() + explosions.size() > peakBodies) peakBodies = planets.size() + explosions.size();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    if(seconds <= 0.0) seconds = std::numeric_limits<double>::min();
+    std::cout << "Elapsed time      : " << seconds << " s" << std::endl;
+    std::cout << "Steps/sec         : " << NB_STEPS / seconds << std::endl;
+    std::cout << "Collisions        : " << nbCollisions << std::endl;
+    std::cout << "Collisions/sec    : " << nbCollisions / seconds << std::endl;
+    std::cout << "Peak planets      : " << peakPlanets << std::endl;
+    std::cout << "Peak particles    : " << peakExplosions << std::endl;
+    std::cout << "Peak bodies       : " << peakBodies << std::endl;
+    std::cout << "Final planets     : " << planets.size() << std::endl;
+}
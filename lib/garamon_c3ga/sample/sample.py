@@ -24,3 +24,63 @@ print("norm : ", mv1.norm())
 print("grade of mv2 : ", mv2.grade())
 
 
+
+
+# batches of multivectors: NumPy arrays of shape (n, 32), or (n, binomial(5, k)) for k-vectors, in Fortran order
+import numpy as np
+
+n = 100
+rng = np.random.default_rng(42)
+batch_mv1 = np.asfortranarray(rng.uniform(-1.0, 1.0, (n, 32)))
+batch_mv2 = np.asfortranarray(rng.uniform(-1.0, 1.0, (n, 32)))
+
+def to_mvec(batch_mv, i):
+    mv = Mvec()
+    for xor_index in range(32):
+        mv[xor_index] = batch_mv[i, batch.column(xor_index)]
+    return mv
+
+mvecs1 = [to_mvec(batch_mv1, i) for i in range(n)]
+mvecs2 = [to_mvec(batch_mv2, i) for i in range(n)]
+
+# compare a batch of full multivectors (or of k-vectors of the given grade) with the same results computed by Mvec
+def compare(name, batch_mv, mvecs, grade=None):
+    if grade is not None:
+        batch_mv = batch.multivectors(batch_mv, grade)
+    error = max(abs(batch_mv[i, batch.column(xor_index)] - mvecs[i][xor_index]) for i in range(n) for xor_index in range(32))
+    print(name, ": largest difference with Mvec", error)
+    assert error < 1e-10
+
+compare("outer product    ", batch.outer(batch_mv1, batch_mv2), [a ^ b for a, b in zip(mvecs1, mvecs2)])
+compare("inner product    ", batch.inner(batch_mv1, batch_mv2), [a | b for a, b in zip(mvecs1, mvecs2)])
+compare("geometric product", batch.geometric(batch_mv1, batch_mv2), [a * b for a, b in zip(mvecs1, mvecs2)])
+compare("dual             ", batch.dual(batch_mv1), [a.dual() for a in mvecs1])
+
+# products of k-vectors, on views (without copy) on a grade of the full multivectors
+vectors1, bivectors2 = batch.grade(batch_mv1, 1), batch.grade(batch_mv2, 2)
+compare("outer product of a vector and a bivector   ", batch.outer(vectors1, 1, bivectors2, 2), [a.grade(1) ^ b.grade(2) for a, b in zip(mvecs1, mvecs2)], 3)
+compare("inner product of a vector and a bivector   ", batch.inner(vectors1, 1, bivectors2, 2), [a.grade(1) | b.grade(2) for a, b in zip(mvecs1, mvecs2)], 1)
+compare("grade 1 of a vector times a bivector       ", batch.geometric(vectors1, 1, bivectors2, 2, 1), [(a.grade(1) * b.grade(2)).grade(1) for a, b in zip(mvecs1, mvecs2)], 1)
+compare("dual of a bivector                         ", batch.dual(bivectors2, 2), [b.grade(2).dual() for b in mvecs2], 3)
+
+# points and dual spheres: e0 + x e1 + y e2 + z e3 + 0.5 (x^2 + y^2 + z^2 - r^2) ei
+centers = np.asfortranarray(rng.uniform(-10.0, 10.0, (n, 3)))
+radii = rng.uniform(1.0, 5.0, n)
+def dual_sphere(center, radius):
+    x, y, z = (float(coordinate) for coordinate in center)
+    radius = float(radius)
+    return e0() + x*e1() + y*e2() + z*e3() + 0.5*(x*x + y*y + z*z - radius*radius)*ei()
+compare("points      ", batch.points(centers), [dual_sphere(c, 0.0) for c in centers], 1)
+compare("dual spheres", batch.dual_spheres(centers, radii), [dual_sphere(c, r) for c, r in zip(centers, radii)], 1)
+
+# the view of batch.grade is the array itself
+view = batch.grade(batch_mv1, 1)
+view[:, 0] = 7.0
+assert (batch_mv1[:, batch.column(E0)] == 7.0).all()
+print("a write in the view of the grade 1 changes the coefficients of e0 of the multivectors")
+
+# the arrays are never copied: an array in C order is refused
+try:
+    batch.outer(np.ascontiguousarray(batch_mv1), batch_mv2)
+except ValueError as error:
+    print("array in C order:", error)
@@ -0,0 +1,181 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Batch.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Batch.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Products, dual and norms of arrays of k-vectors, in the Geometric algebra of c3ga.
+/// A batch of n k-vectors of grade K is stored as a structure of arrays: binomialArray[K] arrays of n coefficients,
+/// one after another, so the coefficient i of the k-vector j is mv[i*n + j]. For instance n points are 5 arrays
+/// (e0, e1, e2, e3 and ei coefficients). Every function computes the same operation on the n k-vectors with the
+/// explicit functions of its grades (selected at compile time), in a loop without any dependency between the
+/// iterations, that the compiler vectorizes (with the SIMD instructions of the target, e.g. AVX2 if enabled).
+/// The results are exactly the ones of Mvec.
+
+
+// Anti-doublon
+#ifndef C3GA_BATCH_HPP__
+#define C3GA_BATCH_HPP__
+#pragma once
+
+// External Includes
+#include <cmath>
+#include <cstddef>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+#include "c3ga/KVector.hpp"
+
+// the rows of a batch never overlap, the compiler would not vectorize the loops writing several rows without this hint
+#if defined(__clang__)
+#define C3GA_BATCH_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define C3GA_BATCH_LOOP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define C3GA_BATCH_LOOP __pragma(loop(ivdep))
+#else
+#define C3GA_BATCH_LOOP
+#endif
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    /*!
+     * @namespace batch
+     * @brief operations on arrays of k-vectors stored as structures of arrays
+     */
+    namespace batch{
+
+        /// \cond DEV
+        /// \brief read the k-vector j of a batch of n k-vectors
+        template<typename T, unsigned int K>
+        inline KVector<T, K> load(const T *mv, const std::size_t n, const std::size_t j){
+            KVector<T, K> kvector;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                kvector.coeffRef(i) = mv[i*n + j];
+            return kvector;
+        }
+
+        /// \brief write the k-vector j of a batch of n k-vectors
+        template<typename T, unsigned int K>
+        inline void store(const KVector<T, K> &kvector, T *mv, const std::size_t n, const std::size_t j){
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv[i*n + j] = kvector.coeff(i);
+        }
+        /// \endcond
+
+        /// \brief Compute the outer products mv1[j] ^ mv2[j] of two batches of n k-vectors
+        /// \tparam GradeMv1 - grade of the k-vectors of mv1
+        /// \tparam GradeMv2 - grade of the k-vectors of mv2
+        /// \param mv1 - the first batch, binomialArray[GradeMv1] arrays of n coefficients
+        /// \param mv2 - the second batch, binomialArray[GradeMv2] arrays of n coefficients
+        /// \param mv3 - output, binomialArray[GradeMv1 + GradeMv2] arrays of n coefficients, must not overlap mv1 and mv2
+        /// \param n - number of k-vectors in each batch
+        template<unsigned int GradeMv1, unsigned int GradeMv2, typename T>
+        inline void outer(const T* __restrict mv1, const T* __restrict mv2, T* __restrict mv3, const std::size_t n){
+            C3GA_BATCH_LOOP
+            for(std::size_t j=0; j<n; ++j)
+                store(load<T, GradeMv1>(mv1, n, j) ^ load<T, GradeMv2>(mv2, n, j), mv3, n, j);
+        }
+
+        /// \brief Compute the inner products mv1[j] . mv2[j] of two batches of n k-vectors
+        /// \tparam GradeMv1 - grade of the k-vectors of mv1
+        /// \tparam GradeMv2 - grade of the k-vectors of mv2
+        /// \param mv1 - the first batch, binomialArray[GradeMv1] arrays of n coefficients
+        /// \param mv2 - the second batch, binomialArray[GradeMv2] arrays of n coefficients
+        /// \param mv3 - output, binomialArray[|GradeMv1 - GradeMv2|] arrays of n coefficients, must not overlap mv1 and mv2
+        /// \param n - number of k-vectors in each batch
+        template<unsigned int GradeMv1, unsigned int GradeMv2, typename T>
+        inline void inner(const T* __restrict mv1, const T* __restrict mv2, T* __restrict mv3, const std::size_t n){
+            C3GA_BATCH_LOOP
+            for(std::size_t j=0; j<n; ++j)
+                store(load<T, GradeMv1>(mv1, n, j) | load<T, GradeMv2>(mv2, n, j), mv3, n, j);
+        }
+
+        /// \brief Compute the part of grade GradeMv3 of the geometric products mv1[j] mv2[j] of two batches of n k-vectors
+        /// (the outer product, the inner product or one of the grades between them)
+        /// \tparam GradeMv3 - grade of the computed part
+        /// \tparam GradeMv1 - grade of the k-vectors of mv1
+        /// \tparam GradeMv2 - grade of the k-vectors of mv2
+        /// \param mv1 - the first batch, binomialArray[GradeMv1] arrays of n coefficients
+        /// \param mv2 - the second batch, binomialArray[GradeMv2] arrays of n coefficients
+        /// \param mv3 - output, binomialArray[GradeMv3] arrays of n coefficients, must not overlap mv1 and mv2
+        /// \param n - number of k-vectors in each batch
+        template<unsigned int GradeMv3, unsigned int GradeMv1, unsigned int GradeMv2, typename T>
+        inline void geometric(const T* __restrict mv1, const T* __restrict mv2, T* __restrict mv3, const std::size_t n){
+            constexpr unsigned int gradeOuter = GradeMv1 + GradeMv2;
+            constexpr unsigned int gradeInner = GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1;
+            static_assert(GradeMv3 >= gradeInner && GradeMv3 <= gradeOuter && (GradeMv3 - gradeInner) % 2 == 0
+                          && GradeMv3 <= 2*algebraDimension - gradeOuter, "the geometric product of these grades has no part of grade GradeMv3");
+            if constexpr(GradeMv3 == gradeOuter)
+                outer<GradeMv1, GradeMv2>(mv1, mv2, mv3, n);
+            else if constexpr(GradeMv3 == gradeInner)
+                inner<GradeMv1, GradeMv2>(mv1, mv2, mv3, n);
+            else{
+                C3GA_BATCH_LOOP
+                for(std::size_t j=0; j<n; ++j){
+                    KVector<T, GradeMv3> kvector;
+                    geometricExplicit<GradeMv3, GradeMv1, GradeMv2, T>(load<T, GradeMv1>(mv1, n, j), load<T, GradeMv2>(mv2, n, j), kvector);
+                    store(kvector, mv3, n, j);
+                }
+            }
+        }
+
+        /// \brief Compute the duals of a batch of n k-vectors, same coefficients as Mvec::dual
+        /// \tparam K - grade of the k-vectors of mv
+        /// \param mv - the batch, binomialArray[K] arrays of n coefficients
+        /// \param dualMv - output, binomialArray[algebraDimension - K] arrays of n coefficients, must not overlap mv
+        /// \param n - number of k-vectors in the batch
+        template<unsigned int K, typename T>
+        inline void dual(const T* __restrict mv, T* __restrict dualMv, const std::size_t n){
+            unsigned int permutation[binomialArray[K]];
+            T coefficient[binomialArray[K]];
+            for(unsigned int i=0; i<binomialArray[K]; ++i){
+                permutation[i] = dualPermutations[K][i];
+                coefficient[i] = T(dualCoefficients[K].coeff(dualPermutations[K][i]));
+            }
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                for(std::size_t j=0; j<n; ++j)
+                    dualMv[permutation[i]*n + j] = mv[i*n + j] * coefficient[i];
+        }
+
+        /// \brief Compute the quadratic norms of a batch of n k-vectors, same values as Mvec::quadraticNorm
+        /// \tparam K - grade of the k-vectors of mv
+        /// \param mv - the batch, binomialArray[K] arrays of n coefficients
+        /// \param quadraticNorms - output, n scalars
+        /// \param n - number of k-vectors in the batch
+        template<unsigned int K, typename T>
+        inline void quadraticNorm(const T* __restrict mv, T* __restrict quadraticNorms, const std::size_t n){
+            for(std::size_t j=0; j<n; ++j){
+                const KVector<T, K> kvector = load<T, K>(mv, n, j);
+                quadraticNorms[j] = T(kvector.reverse() > kvector);
+            }
+        }
+
+        /// \brief Compute the norms of a batch of n k-vectors, same values as Mvec::norm
+        /// \tparam K - grade of the k-vectors of mv
+        /// \param mv - the batch, binomialArray[K] arrays of n coefficients
+        /// \param norms - output, n scalars
+        /// \param n - number of k-vectors in the batch
+        template<unsigned int K, typename T>
+        inline void norm(const T* __restrict mv, T* __restrict norms, const std::size_t n){
+            for(std::size_t j=0; j<n; ++j){
+                const KVector<T, K> kvector = load<T, K>(mv, n, j);
+                norms[j] = T(kvector < kvector.reverse()); // inner product of the same grades, scalars included
+            }
+            for(std::size_t j=0; j<n; ++j) // apart, sqrt may prevent the vectorization of the first loop (errno)
+                norms[j] = std::sqrt(std::fabs(norms[j]));
+        }
+
+    }/// End of Namespace batch
+
+}/// End of Namespace
+
+#endif // C3GA_BATCH_HPP__
@@ -0,0 +1,212 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// BatchDispatch.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file BatchDispatch.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Selection at run time of the instruction set used by the batch functions of Batch.hpp, in the Geometric algebra of c3ga.
+/// The same binary runs on every x86 processor: c3ga::batch::invoke runs its function compiled for SSE4.2, AVX2 or
+/// AVX-512 (every function it calls is inlined in this version), or without any specific instruction (scalar).
+/// The instruction set is selected once, at the first call, among the ones the processor supports (cpuid), and
+/// only if the self-test of the hot kernels (grades 1x1, 1x4, 2x2 and 4x4) gives exactly the results of Mvec.
+/// The multiplications and additions are never contracted (FMA), so every instruction set gives the same results.
+/// For instance:
+/// \code
+///     c3ga::batch::invoke([&]{ c3ga::batch::outer<1,1>(points1, points2, pairPoints, n); });
+/// \endcode
+/// Define C3GA_NO_RUNTIME_DISPATCH to always use the scalar version (it is the only one with other compilers or processors).
+
+
+// Anti-doublon
+#ifndef C3GA_BATCH_DISPATCH_HPP__
+#define C3GA_BATCH_DISPATCH_HPP__
+#pragma once
+
+// External Includes
+#include <cstddef>
+#include <cstdint>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+#include "c3ga/Batch.hpp"
+
+#if !defined(C3GA_NO_RUNTIME_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define C3GA_RUNTIME_DISPATCH
+#endif
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    /*!
+     * @namespace batch
+     * @brief operations on arrays of k-vectors stored as structures of arrays
+     */
+    namespace batch{
+
+        /// \brief instruction sets of the batch functions, from the slowest to the fastest
+        enum class Isa : unsigned int { Scalar = 0, SSE42, AVX2, AVX512 };
+
+        /// \brief name of an instruction set
+        /// \param isa - the instruction set
+        /// \return "scalar", "sse4.2", "avx2" or "avx512"
+        inline const char* isaName(const Isa isa){
+            switch(isa){
+                case Isa::SSE42: return "sse4.2";
+                case Isa::AVX2: return "avx2";
+                case Isa::AVX512: return "avx512";
+                default: return "scalar";
+            }
+        }
+
+        /// \brief tell whether the processor (and the system) supports an instruction set
+        /// \param isa - the instruction set
+        /// \return true if the batch functions can run with this instruction set
+        inline bool isaSupported(const Isa isa){
+#ifdef C3GA_RUNTIME_DISPATCH
+            __builtin_cpu_init(); // may be called before the initialization of the program (static variables)
+            switch(isa){
+                case Isa::SSE42: return __builtin_cpu_supports("sse4.2");
+                case Isa::AVX2: return __builtin_cpu_supports("avx2");
+                case Isa::AVX512: return __builtin_cpu_supports("avx512f");
+                default: return true;
+            }
+#else
+            return isa == Isa::Scalar;
+#endif
+        }
+
+        /// \cond DEV
+        // one version of invoke per instruction set, flatten inlines the function (and all its calls) in each of them
+        template<typename F>
+        inline void invokeScalar(const F &f){
+            f();
+        }
+
+#ifdef C3GA_RUNTIME_DISPATCH
+        template<typename F>
+        __attribute__((target("sse4.2"), flatten)) void invokeSSE42(const F &f){
+            f();
+        }
+
+        template<typename F>
+        __attribute__((target("avx2"), flatten)) void invokeAVX2(const F &f){
+            f();
+        }
+
+        // AVX-512F has its own FMA instructions, the multiplications and additions must not be contracted
+        // (clang ignores this attribute, the self-test rejects this version if its results differ)
+        template<typename F>
+#if defined(__clang__)
+        __attribute__((target("avx512f"), flatten)) void invokeAVX512(const F &f){
+#else
+        __attribute__((target("avx512f"), optimize("fp-contract=off"), flatten)) void invokeAVX512(const F &f){
+#endif
+            f();
+        }
+#endif
+        /// \endcond
+
+        /// \brief run a function compiled for a given instruction set
+        /// \param isa - the instruction set, it must be supported (see isaSupported)
+        /// \param f - function without parameter, calling the batch functions
+        template<typename F>
+        inline void invoke(const Isa isa, const F &f){
+#ifdef C3GA_RUNTIME_DISPATCH
+            switch(isa){
+                case Isa::SSE42: invokeSSE42(f); return;
+                case Isa::AVX2: invokeAVX2(f); return;
+                case Isa::AVX512: invokeAVX512(f); return;
+                default: break;
+            }
+#else
+            (void)isa; // only the scalar version is compiled
+#endif
+            invokeScalar(f);
+        }
+
+        /// \cond DEV
+        /// \brief compare the k-vector j of a batch with the part of grade K of a multivector
+        template<unsigned int K, typename T>
+        inline bool sameAsMvec(const T *mv, const std::size_t n, const std::size_t j, const Mvec<T> &reference){
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                if(mv[i*n + j] != reference.kvec(K).coeff(i))
+                    return false;
+            return true;
+        }
+        /// \endcond
+
+        /// \brief check that the batch functions of the hot grades (1x1, 1x4, 2x2 and 4x4), compiled for an instruction set,
+        /// give exactly the results of the products of Mvec
+        /// \tparam T - type of the coefficients
+        /// \param isa - the instruction set, it must be supported (see isaSupported)
+        /// \return true if every result is the same
+        template<typename T>
+        bool selfTest(const Isa isa){
+            const std::size_t n = 37; // not a multiple of the sizes of the vector registers, the remaining iterations are tested too
+            T vectors1[5*n], vectors2[5*n], bivectors1[10*n], bivectors2[10*n], quadvectors1[5*n], quadvectors2[5*n];
+            std::uint32_t seed = 12345; // deterministic values in [-2, 2], with a linear congruential generator
+            const auto fill = [&seed](T *mv, const std::size_t size){
+                for(std::size_t i=0; i<size; ++i){
+                    seed = seed * 1664525u + 1013904223u;
+                    mv[i] = T(seed >> 8) / T(1u << 22) - T(2);
+                }
+            };
+            fill(vectors1, 5*n); fill(vectors2, 5*n); fill(bivectors1, 10*n); fill(bivectors2, 10*n); fill(quadvectors1, 5*n); fill(quadvectors2, 5*n);
+
+            T outer11[10*n], inner11[n], outer14[n], inner14[10*n], outer22[5*n], geometric22[10*n], inner22[n], inner44[n];
+            invoke(isa, [&]{
+                outer<1,1>(vectors1, vectors2, outer11, n);
+                inner<1,1>(vectors1, vectors2, inner11, n);
+                outer<1,4>(vectors1, quadvectors1, outer14, n);
+                inner<1,4>(vectors1, quadvectors1, inner14, n);
+                outer<2,2>(bivectors1, bivectors2, outer22, n);
+                geometric<2,2,2>(bivectors1, bivectors2, geometric22, n);
+                inner<2,2>(bivectors1, bivectors2, inner22, n);
+                inner<4,4>(quadvectors1, quadvectors2, inner44, n);
+            });
+
+            for(std::size_t j=0; j<n; ++j){
+                const Mvec<T> vector1 = load<T, 1>(vectors1, n, j).toMvec(), vector2 = load<T, 1>(vectors2, n, j).toMvec();
+                const Mvec<T> bivector1 = load<T, 2>(bivectors1, n, j).toMvec(), bivector2 = load<T, 2>(bivectors2, n, j).toMvec();
+                const Mvec<T> quadvector1 = load<T, 4>(quadvectors1, n, j).toMvec(), quadvector2 = load<T, 4>(quadvectors2, n, j).toMvec();
+                if(!sameAsMvec<2>(outer11, n, j, vector1 ^ vector2) || !sameAsMvec<0>(inner11, n, j, vector1 | vector2)
+                   || !sameAsMvec<5>(outer14, n, j, vector1 ^ quadvector1) || !sameAsMvec<3>(inner14, n, j, vector1 | quadvector1)
+                   || !sameAsMvec<4>(outer22, n, j, bivector1 ^ bivector2) || !sameAsMvec<2>(geometric22, n, j, bivector1.productGrade(2, bivector2))
+                   || !sameAsMvec<0>(inner22, n, j, bivector1 | bivector2) || !sameAsMvec<0>(inner44, n, j, quadvector1 | quadvector2))
+                    return false;
+            }
+            return true;
+        }
+
+        /// \brief the instruction set of invoke(f): the fastest one supported by the processor that passes the self-tests
+        /// (in float and double), selected at the first call
+        /// \return the selected instruction set
+        inline Isa selectedIsa(){
+            static const Isa selected = []{
+                for(Isa isa : {Isa::AVX512, Isa::AVX2, Isa::SSE42})
+                    if(isaSupported(isa) && selfTest<float>(isa) && selfTest<double>(isa))
+                        return isa;
+                return Isa::Scalar;
+            }();
+            return selected;
+        }
+
+        /// \brief run a function compiled for the selected instruction set (see selectedIsa)
+        /// \param f - function without parameter, calling the batch functions
+        template<typename F>
+        inline void invoke(const F &f){
+            invoke(selectedIsa(), f);
+        }
+
+    }/// End of Namespace batch
+
+}/// End of Namespace
+
+#endif // C3GA_BATCH_DISPATCH_HPP__
@@ -61,6 +61,14 @@ namespace c3ga{
 
     constexpr unsigned int binomialArray[6] = {1,5,10,10,5,1};  /*!< array of the (dimension + 1) first binomial coefficients */
 
+    constexpr unsigned int nbCoefficients = 32; /*!< number of coefficients of a full multivector (sum of binomialArray) */
+
+    template<typename T>
+    using KvecRef = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1>>; /*!< view on the coefficients of a k-vector, usually the slot of grade k of a multivector */
+
+    template<typename T>
+    using ConstKvecRef = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>; /*!< read-only view on the coefficients of a k-vector */
+
     constexpr unsigned int xorIndexToGrade[] = {0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4,1,2,2,3,2,3,3,4,2,3,3,4,3,4,4,5}; /*!< given a Xor index in a multivector, this array indicates the corresponding grade*/ 
 
     constexpr unsigned int xorIndexToHomogeneousIndex[] = {0,0,1,0,2,1,4,0,3,2,5,1,7,3,6,0,4,3,6,2,8,4,7,1,9,5,8,2,9,3,4,0}; /*!< given a Xor index in a multivector, this array indicates the corresponding index in the whole homogeneous vector*/
@@ -74,7 +82,7 @@ namespace c3ga{
 
     constexpr double pseudoScalarInverse = -1.000000; /*!< compute the inverse of the pseudo scalar */
 
-    const int signReversePerGrade[6] = {1,1,-1,-1,1,1}; /*!< array of signs to avoid the computation of (-1)^k*(k-1)/2 during the reverse operation */
+    constexpr int signReversePerGrade[6] = {1,1,-1,-1,1,1}; /*!< array of signs to avoid the computation of (-1)^k*(k-1)/2 during the reverse operation */
 
     const std::vector<std::string> basisVectors = {"0", "1", "2", "3", "i"}; /*!< name of the basis vectors (of grade 1) */
 
@@ -30,11 +30,11 @@ namespace c3ga {
 
     /// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 2
-	template<typename T>
-	void geometric_2_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_2_2_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(5) - mv1.coeff(3)*mv2.coeff(0) + mv1.coeff(4)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(7) - mv1.coeff(3)*mv2.coeff(1) - mv1.coeff(4)*mv2.coeff(0) + mv1.coeff(7)*mv2.coeff(2);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(5) + mv1.coeff(1)*mv2.coeff(7) + mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(5)*mv2.coeff(0) - mv1.coeff(7)*mv2.coeff(1);
@@ -50,11 +50,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
-	template<typename T>
-	void geometric_2_3_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_2_3_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(6) - mv1.coeff(3)*mv2.coeff(0) - mv1.coeff(5)*mv2.coeff(3) + mv1.coeff(7)*mv2.coeff(1);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(6) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(3) - mv1.coeff(7)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(7) - mv1.coeff(2)*mv2.coeff(8) + mv1.coeff(4)*mv2.coeff(4) + mv1.coeff(5)*mv2.coeff(5) - mv1.coeff(8)*mv2.coeff(0) - mv1.coeff(9)*mv2.coeff(1);
@@ -70,11 +70,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 4
-	template<typename T>
-	void geometric_2_4_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_2_4_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(2)*mv2.coeff(4) - mv1.coeff(5)*mv2.coeff(3) + mv1.coeff(7)*mv2.coeff(2) - mv1.coeff(9)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(3) - mv1.coeff(7)*mv2.coeff(1) + mv1.coeff(8)*mv2.coeff(0);
@@ -85,11 +85,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
-	template<typename T>
-	void geometric_3_2_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_3_2_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(7) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(5) + mv1.coeff(4)*mv2.coeff(0) - mv1.coeff(6)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(7) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(5)*mv2.coeff(0) + mv1.coeff(6)*mv2.coeff(1);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(8) + mv1.coeff(1)*mv2.coeff(9) - mv1.coeff(4)*mv2.coeff(4) - mv1.coeff(5)*mv2.coeff(5) + mv1.coeff(7)*mv2.coeff(1) + mv1.coeff(8)*mv2.coeff(2);
@@ -105,11 +105,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 2
-	template<typename T>
-	void geometric_3_3_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_3_3_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(5) - mv1.coeff(3)*mv2.coeff(6) + mv1.coeff(4)*mv2.coeff(0) + mv1.coeff(5)*mv2.coeff(1) + mv1.coeff(6)*mv2.coeff(3);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(1)*mv2.coeff(6) - mv1.coeff(2)*mv2.coeff(0) - mv1.coeff(3)*mv2.coeff(5) + mv1.coeff(5)*mv2.coeff(3) - mv1.coeff(6)*mv2.coeff(1);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(6) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(4) - mv1.coeff(4)*mv2.coeff(3) + mv1.coeff(6)*mv2.coeff(0);
@@ -125,11 +125,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 4
-	template<typename T>
-	void geometric_3_3_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_3_3_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(5) + mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(2) + mv1.coeff(4)*mv2.coeff(1) - mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(1)*mv2.coeff(9) + mv1.coeff(3)*mv2.coeff(8) - mv1.coeff(5)*mv2.coeff(6) - mv1.coeff(6)*mv2.coeff(5) + mv1.coeff(8)*mv2.coeff(3) - mv1.coeff(9)*mv2.coeff(1);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(3)*mv2.coeff(7) + mv1.coeff(4)*mv2.coeff(6) + mv1.coeff(6)*mv2.coeff(4) - mv1.coeff(7)*mv2.coeff(3) + mv1.coeff(9)*mv2.coeff(0);
@@ -140,11 +140,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
-	template<typename T>
-	void geometric_3_4_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_3_4_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(6)*mv2.coeff(3) - mv1.coeff(9)*mv2.coeff(0);
@@ -160,11 +160,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 4
-	template<typename T>
-	void geometric_4_2_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_4_2_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(2)*mv2.coeff(7) + mv1.coeff(3)*mv2.coeff(5) - mv1.coeff(4)*mv2.coeff(2);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(8) + mv1.coeff(1)*mv2.coeff(7) - mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(1);
@@ -175,11 +175,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 3
-	template<typename T>
-	void geometric_4_3_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_4_3_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(5) + mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(1);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(9) + mv1.coeff(3)*mv2.coeff(6) - mv1.coeff(4)*mv2.coeff(3);
@@ -195,11 +195,11 @@ namespace c3ga {
 
 	/// \brief Compute the geometric product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something else.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1 mv2 whose grade is 2
-	template<typename T>
-	void geometric_4_4_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void geometric_4_4_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(3) + mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(1)*mv2.coeff(0);
@@ -215,7 +215,7 @@ namespace c3ga {
 
 	
     template<typename T>
-	std::array<std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 6>, 6>, 6> geometricFunctionsContainer =
+	std::array<std::array<std::array<std::function<void(ConstKvecRef<T>, ConstKvecRef<T>, KvecRef<T>)>, 6>, 6>, 6> geometricFunctionsContainer =
 	{{
 		{{
 			{{{},{},{},{},{},{}}},
@@ -267,6 +267,70 @@ namespace c3ga {
 		}}
 	}};
 
+    /// \brief Compute the part of grade gradeMv3 of the geometric product between two homogeneous multivectors mv1 and mv2 of grades given at runtime,
+	/// for the grades that are neither the outer nor the inner product, with the explicit function of these grades.
+	/// The function is selected by a switch on the grades, so the compiler can inline the explicit functions in the products of Mvec.
+	/// Define C3GA_STD_FUNCTION_DISPATCH to call them through geometricFunctionsContainer instead.
+	/// \param gradeMv3 - grade of the result
+	/// \param gradeMv1 - grade of mv1
+	/// \param gradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients
+	/// \param mv2 - the second homogeneous multivector given by its coefficients
+	/// \param mv3 - the part of grade gradeMv3 of mv1 mv2
+	template<typename T>
+	inline void geometricExplicitDispatch(const unsigned int gradeMv3, const unsigned int gradeMv1, const unsigned int gradeMv2, ConstKvecRef<T> mv1, ConstKvecRef<T> mv2, KvecRef<T> mv3){
+#ifdef C3GA_STD_FUNCTION_DISPATCH
+		geometricFunctionsContainer<T>[gradeMv3][gradeMv1][gradeMv2](mv1, mv2, mv3);
+#else
+		switch(gradeMv3*36 + gradeMv1*6 + gradeMv2){
+			case 2*36+2*6+2: geometric_2_2_2<T>(mv1, mv2, mv3); break;
+			case 3*36+2*6+3: geometric_2_3_3<T>(mv1, mv2, mv3); break;
+			case 4*36+2*6+4: geometric_2_4_4<T>(mv1, mv2, mv3); break;
+			case 3*36+3*6+2: geometric_3_2_3<T>(mv1, mv2, mv3); break;
+			case 2*36+3*6+3: geometric_3_3_2<T>(mv1, mv2, mv3); break;
+			case 4*36+3*6+3: geometric_3_3_4<T>(mv1, mv2, mv3); break;
+			case 3*36+3*6+4: geometric_3_4_3<T>(mv1, mv2, mv3); break;
+			case 4*36+4*6+2: geometric_4_2_4<T>(mv1, mv2, mv3); break;
+			case 3*36+4*6+3: geometric_4_3_3<T>(mv1, mv2, mv3); break;
+			case 2*36+4*6+4: geometric_4_4_2<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+#endif
+	}
+
+    /// \brief Compute the part of grade GradeMv3 of the geometric product between two homogeneous multivectors mv1 (grade GradeMv1) and mv2 (grade GradeMv2), for the grades that are neither the outer nor the inner product. The explicit function is selected at compile time.
+	/// \tparam GradeMv3 - grade of the result
+	/// \tparam GradeMv1 - grade of mv1
+	/// \tparam GradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv3 - the part of grade GradeMv3 of mv1 mv2
+	template<unsigned int GradeMv3, unsigned int GradeMv1, unsigned int GradeMv2, typename T, typename Mv1, typename Mv2, typename Mv3>
+	constexpr void geometricExplicit(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		if constexpr(GradeMv3 == 2 && GradeMv1 == 2 && GradeMv2 == 2)
+			geometric_2_2_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 3 && GradeMv1 == 2 && GradeMv2 == 3)
+			geometric_2_3_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 4 && GradeMv1 == 2 && GradeMv2 == 4)
+			geometric_2_4_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 3 && GradeMv1 == 3 && GradeMv2 == 2)
+			geometric_3_2_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 2 && GradeMv1 == 3 && GradeMv2 == 3)
+			geometric_3_3_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 4 && GradeMv1 == 3 && GradeMv2 == 3)
+			geometric_3_3_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 3 && GradeMv1 == 3 && GradeMv2 == 4)
+			geometric_3_4_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 4 && GradeMv1 == 4 && GradeMv2 == 2)
+			geometric_4_2_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 3 && GradeMv1 == 4 && GradeMv2 == 3)
+			geometric_4_3_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv3 == 2 && GradeMv1 == 4 && GradeMv2 == 4)
+			geometric_4_4_2<T>(mv1, mv2, mv3);
+		else
+			static_assert(GradeMv1 != GradeMv1, "no explicit function for these grades");
+	}
+
 }/// End of Namespace
 
 #endif // C3GA_GEOMETRIC_PRODUCT_EXPLICIT_HPP__
\ No newline at end of file
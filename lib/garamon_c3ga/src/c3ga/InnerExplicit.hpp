@@ -30,99 +30,129 @@ namespace c3ga {
 
     /// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_0_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_0_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_0_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
+		mv3.coeffRef(5) += mv1.coeff(0)*mv2.coeff(5);
+		mv3.coeffRef(6) += mv1.coeff(0)*mv2.coeff(6);
+		mv3.coeffRef(7) += mv1.coeff(0)*mv2.coeff(7);
+		mv3.coeffRef(8) += mv1.coeff(0)*mv2.coeff(8);
+		mv3.coeffRef(9) += mv1.coeff(0)*mv2.coeff(9);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_0_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
+		mv3.coeffRef(5) += mv1.coeff(0)*mv2.coeff(5);
+		mv3.coeffRef(6) += mv1.coeff(0)*mv2.coeff(6);
+		mv3.coeffRef(7) += mv1.coeff(0)*mv2.coeff(7);
+		mv3.coeffRef(8) += mv1.coeff(0)*mv2.coeff(8);
+		mv3.coeffRef(9) += mv1.coeff(0)*mv2.coeff(9);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void inner_0_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void inner_0_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_0_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_1_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_1_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_1_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(0) - mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(6) - mv1.coeff(2)*mv2.coeff(4) - mv1.coeff(3)*mv2.coeff(5) - mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(8) + mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(3)*mv2.coeff(7) - mv1.coeff(4)*mv2.coeff(1);
@@ -133,11 +163,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_1_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(0) + mv1.coeff(3)*mv2.coeff(1);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(0) + mv1.coeff(3)*mv2.coeff(3);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(3);
@@ -153,11 +183,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_1_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(2);
@@ -173,11 +203,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void inner_1_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_1_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(2)*mv2.coeff(0);
@@ -188,22 +218,31 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_2_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
+		mv3.coeffRef(5) += mv1.coeff(5)*mv2.coeff(0);
+		mv3.coeffRef(6) += mv1.coeff(6)*mv2.coeff(0);
+		mv3.coeffRef(7) += mv1.coeff(7)*mv2.coeff(0);
+		mv3.coeffRef(8) += mv1.coeff(8)*mv2.coeff(0);
+		mv3.coeffRef(9) += mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_2_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(2) + mv1.coeff(5)*mv2.coeff(3) - mv1.coeff(6)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(4)*mv2.coeff(1) + mv1.coeff(7)*mv2.coeff(3) - mv1.coeff(8)*mv2.coeff(0);
@@ -214,22 +253,22 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(6) - mv1.coeff(1)*mv2.coeff(8) - mv1.coeff(2)*mv2.coeff(9) + mv1.coeff(3)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(4) - mv1.coeff(5)*mv2.coeff(5) - mv1.coeff(6)*mv2.coeff(0) - mv1.coeff(7)*mv2.coeff(7) - mv1.coeff(8)*mv2.coeff(1) - mv1.coeff(9)*mv2.coeff(2);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_2_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(5) - mv1.coeff(4)*mv2.coeff(0) - mv1.coeff(5)*mv2.coeff(1) - mv1.coeff(7)*mv2.coeff(3);
 		mv3.coeffRef(1) += -mv1.coeff(1)*mv2.coeff(7) - mv1.coeff(2)*mv2.coeff(8) - mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(7)*mv2.coeff(6) + mv1.coeff(8)*mv2.coeff(0) + mv1.coeff(9)*mv2.coeff(1);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(7) - mv1.coeff(2)*mv2.coeff(9) - mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(5)*mv2.coeff(6) - mv1.coeff(6)*mv2.coeff(0) + mv1.coeff(9)*mv2.coeff(3);
@@ -240,11 +279,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_2_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(7)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(0);
@@ -260,11 +299,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_2_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_2_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(7)*mv2.coeff(0);
@@ -280,22 +319,31 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_3_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
+		mv3.coeffRef(5) += mv1.coeff(5)*mv2.coeff(0);
+		mv3.coeffRef(6) += mv1.coeff(6)*mv2.coeff(0);
+		mv3.coeffRef(7) += mv1.coeff(7)*mv2.coeff(0);
+		mv3.coeffRef(8) += mv1.coeff(8)*mv2.coeff(0);
+		mv3.coeffRef(9) += mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_3_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) + mv1.coeff(1)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(3) - mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(5)*mv2.coeff(0);
@@ -311,11 +359,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_3_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(5) - mv1.coeff(2)*mv2.coeff(0) - mv1.coeff(3)*mv2.coeff(7) - mv1.coeff(4)*mv2.coeff(1) - mv1.coeff(5)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(8) + mv1.coeff(1)*mv2.coeff(9) - mv1.coeff(2)*mv2.coeff(3) - mv1.coeff(6)*mv2.coeff(7) - mv1.coeff(7)*mv2.coeff(1) - mv1.coeff(8)*mv2.coeff(2);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(6) + mv1.coeff(3)*mv2.coeff(9) - mv1.coeff(4)*mv2.coeff(3) + mv1.coeff(6)*mv2.coeff(5) + mv1.coeff(7)*mv2.coeff(0) - mv1.coeff(9)*mv2.coeff(2);
@@ -326,22 +374,22 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_3_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(7) + mv1.coeff(1)*mv2.coeff(8) + mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(9) + mv1.coeff(4)*mv2.coeff(4) + mv1.coeff(5)*mv2.coeff(5) - mv1.coeff(6)*mv2.coeff(6) + mv1.coeff(7)*mv2.coeff(0) + mv1.coeff(8)*mv2.coeff(1) + mv1.coeff(9)*mv2.coeff(3);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_3_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(3) + mv1.coeff(6)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(2) + mv1.coeff(9)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(3) - mv1.coeff(8)*mv2.coeff(0);
@@ -352,11 +400,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_3_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_3_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(0);
@@ -372,22 +420,26 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void inner_4_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_4_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(3);
@@ -403,11 +455,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_4_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(7) - mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(5) + mv1.coeff(1)*mv2.coeff(0) - mv1.coeff(3)*mv2.coeff(2);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(4) + mv1.coeff(2)*mv2.coeff(0) + mv1.coeff(3)*mv2.coeff(1);
@@ -423,11 +475,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_4_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(6) + mv1.coeff(1)*mv2.coeff(0) + mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(3)*mv2.coeff(3);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(5) + mv1.coeff(4)*mv2.coeff(3);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(8) + mv1.coeff(1)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(5) - mv1.coeff(4)*mv2.coeff(1);
@@ -438,22 +490,22 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_4_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(1) - mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(3) + mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_4_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_4_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) += -mv1.coeff(2)*mv2.coeff(0);
@@ -464,22 +516,22 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void inner_5_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void inner_5_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(3);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(2);
@@ -490,11 +542,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void inner_5_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(2);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(1);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(7);
@@ -510,11 +562,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void inner_5_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3);
 		mv3.coeffRef(1) += -mv1.coeff(0)*mv2.coeff(1);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(0);
@@ -530,11 +582,11 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void inner_5_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3);
 		mv3.coeffRef(2) += -mv1.coeff(0)*mv2.coeff(2);
@@ -545,18 +597,18 @@ namespace c3ga {
 
 	/// \brief Compute the inner product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1.mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void inner_5_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void inner_5_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) += -mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	
     template<typename T>
-	std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 6>, 6> innerFunctionsContainer = {{
+	std::array<std::array<std::function<void(ConstKvecRef<T>, ConstKvecRef<T>, KvecRef<T>)>, 6>, 6> innerFunctionsContainer = {{
 		{{inner_0_0<T>,inner_0_1<T>,inner_0_2<T>,inner_0_3<T>,inner_0_4<T>,inner_0_5<T>}},
 		{{inner_1_0<T>,inner_1_1<T>,inner_1_2<T>,inner_1_3<T>,inner_1_4<T>,inner_1_5<T>}},
 		{{inner_2_0<T>,inner_2_1<T>,inner_2_2<T>,inner_2_3<T>,inner_2_4<T>,inner_2_5<T>}},
@@ -565,6 +617,144 @@ namespace c3ga {
 		{{inner_5_0<T>,inner_5_1<T>,inner_5_2<T>,inner_5_3<T>,inner_5_4<T>,inner_5_5<T>}}
 	}};
 
+    /// \brief Compute the inner product between two homogeneous multivectors mv1 and mv2 of grades given at runtime, with the explicit function of these grades.
+	/// The function is selected by a switch on the grades, so the compiler can inline the explicit functions in the products of Mvec.
+	/// Define C3GA_STD_FUNCTION_DISPATCH to call them through innerFunctionsContainer instead.
+	/// \param gradeMv1 - grade of mv1
+	/// \param gradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients
+	/// \param mv2 - the second homogeneous multivector given by its coefficients
+	/// \param mv3 - the result of mv1.mv2
+	template<typename T>
+	inline void innerExplicitDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, ConstKvecRef<T> mv1, ConstKvecRef<T> mv2, KvecRef<T> mv3){
+#ifdef C3GA_STD_FUNCTION_DISPATCH
+		innerFunctionsContainer<T>[gradeMv1][gradeMv2](mv1, mv2, mv3);
+#else
+		switch(gradeMv1*6 + gradeMv2){
+			case 0*6+0: inner_0_0<T>(mv1, mv2, mv3); break;
+			case 0*6+1: inner_0_1<T>(mv1, mv2, mv3); break;
+			case 0*6+2: inner_0_2<T>(mv1, mv2, mv3); break;
+			case 0*6+3: inner_0_3<T>(mv1, mv2, mv3); break;
+			case 0*6+4: inner_0_4<T>(mv1, mv2, mv3); break;
+			case 0*6+5: inner_0_5<T>(mv1, mv2, mv3); break;
+			case 1*6+0: inner_1_0<T>(mv1, mv2, mv3); break;
+			case 1*6+1: inner_1_1<T>(mv1, mv2, mv3); break;
+			case 1*6+2: inner_1_2<T>(mv1, mv2, mv3); break;
+			case 1*6+3: inner_1_3<T>(mv1, mv2, mv3); break;
+			case 1*6+4: inner_1_4<T>(mv1, mv2, mv3); break;
+			case 1*6+5: inner_1_5<T>(mv1, mv2, mv3); break;
+			case 2*6+0: inner_2_0<T>(mv1, mv2, mv3); break;
+			case 2*6+1: inner_2_1<T>(mv1, mv2, mv3); break;
+			case 2*6+2: inner_2_2<T>(mv1, mv2, mv3); break;
+			case 2*6+3: inner_2_3<T>(mv1, mv2, mv3); break;
+			case 2*6+4: inner_2_4<T>(mv1, mv2, mv3); break;
+			case 2*6+5: inner_2_5<T>(mv1, mv2, mv3); break;
+			case 3*6+0: inner_3_0<T>(mv1, mv2, mv3); break;
+			case 3*6+1: inner_3_1<T>(mv1, mv2, mv3); break;
+			case 3*6+2: inner_3_2<T>(mv1, mv2, mv3); break;
+			case 3*6+3: inner_3_3<T>(mv1, mv2, mv3); break;
+			case 3*6+4: inner_3_4<T>(mv1, mv2, mv3); break;
+			case 3*6+5: inner_3_5<T>(mv1, mv2, mv3); break;
+			case 4*6+0: inner_4_0<T>(mv1, mv2, mv3); break;
+			case 4*6+1: inner_4_1<T>(mv1, mv2, mv3); break;
+			case 4*6+2: inner_4_2<T>(mv1, mv2, mv3); break;
+			case 4*6+3: inner_4_3<T>(mv1, mv2, mv3); break;
+			case 4*6+4: inner_4_4<T>(mv1, mv2, mv3); break;
+			case 4*6+5: inner_4_5<T>(mv1, mv2, mv3); break;
+			case 5*6+0: inner_5_0<T>(mv1, mv2, mv3); break;
+			case 5*6+1: inner_5_1<T>(mv1, mv2, mv3); break;
+			case 5*6+2: inner_5_2<T>(mv1, mv2, mv3); break;
+			case 5*6+3: inner_5_3<T>(mv1, mv2, mv3); break;
+			case 5*6+4: inner_5_4<T>(mv1, mv2, mv3); break;
+			case 5*6+5: inner_5_5<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+#endif
+	}
+
+    /// \brief Compute the inner product between two homogeneous multivectors mv1 (grade GradeMv1) and mv2 (grade GradeMv2), the explicit function is selected at compile time.
+	/// \tparam GradeMv1 - grade of mv1
+	/// \tparam GradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv3 - the result of mv1.mv2, whose grade is |GradeMv1 - GradeMv2|
+	template<unsigned int GradeMv1, unsigned int GradeMv2, typename T, typename Mv1, typename Mv2, typename Mv3>
+	constexpr void innerExplicit(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		static_assert(GradeMv1 <= algebraDimension && GradeMv2 <= algebraDimension, "grade higher than the dimension of the algebra");
+		if constexpr(GradeMv1 == 0 && GradeMv2 == 0)
+			inner_0_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 1)
+			inner_0_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 2)
+			inner_0_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 3)
+			inner_0_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 4)
+			inner_0_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 5)
+			inner_0_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 0)
+			inner_1_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 1)
+			inner_1_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 2)
+			inner_1_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 3)
+			inner_1_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 4)
+			inner_1_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 5)
+			inner_1_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 0)
+			inner_2_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 1)
+			inner_2_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 2)
+			inner_2_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 3)
+			inner_2_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 4)
+			inner_2_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 5)
+			inner_2_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 0)
+			inner_3_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 1)
+			inner_3_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 2)
+			inner_3_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 3)
+			inner_3_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 4)
+			inner_3_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 5)
+			inner_3_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 0)
+			inner_4_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 1)
+			inner_4_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 2)
+			inner_4_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 3)
+			inner_4_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 4)
+			inner_4_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 5)
+			inner_4_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 0)
+			inner_5_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 1)
+			inner_5_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 2)
+			inner_5_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 3)
+			inner_5_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 4)
+			inner_5_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 5)
+			inner_5_5<T>(mv1, mv2, mv3);
+	}
+
 }/// End of Namespace
 
 #endif // C3GA_INNER_PRODUCT_EXPLICIT_HPP__
\ No newline at end of file
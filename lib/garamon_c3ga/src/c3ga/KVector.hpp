@@ -0,0 +1,295 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// KVector.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file KVector.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Class to define a k-vector whose grade is known at compile time, in the Geometric algebra of c3ga.
+/// The products between k-vectors call the right explicit function at compile time (without going through the
+/// function containers of Mvec) and give exactly the same coefficients as the products between the corresponding Mvec.
+
+
+// Anti-doublon
+#ifndef C3GA_K_VECTOR_HPP__
+#define C3GA_K_VECTOR_HPP__
+#pragma once
+
+// External Includes
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+
+    /// \class KVector
+    /// \brief class defining a homogeneous multivector of grade K (k-vector).
+    /// Only its binomialArray[K] coefficients are stored, in the same order as the slot of grade K of a Mvec,
+    /// so the conversions from and to Mvec are exact. Every function that does not involve a Mvec is constexpr.
+    /// \tparam T - type of the coefficients
+    /// \tparam K - grade of the k-vector
+    template<typename T, unsigned int K>
+    class KVector {
+
+        static_assert(K <= algebraDimension, "the grade of a k-vector can not be higher than the dimension of the algebra");
+
+    protected:
+        std::array<T, binomialArray[K]> coefficients; /*!< coefficients of the k-vector */
+
+    public:
+
+        /// \brief Default constructor, generate a k-vector with all its coefficients to 0.
+        constexpr KVector() : coefficients() {}
+
+        /// \brief Constructor of a k-vector from all its coefficients, for instance Vec1<double>(e0, e1, e2, e3, ei)
+        /// \param values - the binomialArray[K] coefficients, in the order of the grade K of the basis
+        template<typename... S, typename = std::enable_if_t<sizeof...(S) == binomialArray[K] && std::conjunction_v<std::is_arithmetic<S>...>>>
+        constexpr KVector(const S... values) : coefficients{{T(values)...}} {}
+
+        /// \brief Constructor of a k-vector from an array of coefficients
+        /// \param values - pointer to the binomialArray[K] coefficients, in the order of the grade K of the basis
+        constexpr explicit KVector(const T *values) : coefficients() {
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                coefficients[i] = values[i];
+        }
+
+        /// \brief Constructor of a k-vector from the grade K of a multivector (the other grades are ignored)
+        /// \param mv - the multivector to be converted
+        explicit KVector(const Mvec<T> &mv) : coefficients() {
+            const ConstKvecRef<T> slot = mv.kvec(K);
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                coefficients[i] = slot.coeff(i);
+        }
+
+        /// \brief convert the k-vector to a multivector of grade K (the grade is contained even if all its coefficients are 0)
+        /// \return the multivector with the same coefficients
+        Mvec<T> toMvec() const {
+            Mvec<T> mv;
+            KvecRef<T> slot = mv.createVectorXdIfDoesNotExist(K);
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                slot.coeffRef(i) = coefficients[i];
+            return mv;
+        }
+
+        /// \brief grade of the k-vector
+        static constexpr unsigned int grade() { return K; }
+
+        /// \brief number of coefficients of the k-vector
+        static constexpr unsigned int size() { return binomialArray[K]; }
+
+        /// \brief pointer to the coefficients of the k-vector
+        constexpr const T* data() const { return coefficients.data(); }
+
+        /// \brief pointer to the coefficients of the k-vector
+        constexpr T* data() { return coefficients.data(); }
+
+        /// \brief read the ith coefficient of the k-vector (as Eigen::Matrix::coeff, used by the explicit functions)
+        /// \param i - index of the coefficient in the k-vector
+        constexpr const T& coeff(const std::size_t i) const { return coefficients[i]; }
+
+        /// \brief access the ith coefficient of the k-vector (as Eigen::Matrix::coeffRef, used by the explicit functions)
+        /// \param i - index of the coefficient in the k-vector
+        constexpr T& coeffRef(const std::size_t i) { return coefficients[i]; }
+
+        /// \brief Overload the [] operator to access an element of the k-vector, with the same indices as Mvec, e.g. v[E12]
+        /// \param idx - the xor index of the basis blade, its grade has to be K
+        /// \return the coefficient of this basis blade
+        constexpr const T& operator[](const int idx) const { return coefficients[xorIndexToHomogeneousIndex[idx]]; }
+
+        /// \brief Overload the [] operator to modify an element of the k-vector, with the same indices as Mvec, e.g. v[E12] = 1
+        /// \param idx - the xor index of the basis blade, its grade has to be K
+        /// \return the coefficient of this basis blade
+        constexpr T& operator[](const int idx) { return coefficients[xorIndexToHomogeneousIndex[idx]]; }
+
+        /// \brief convert a scalar (k-vector of grade 0) to its value
+        template<unsigned int G = K, typename = std::enable_if_t<G == 0>>
+        constexpr operator T() const { return coefficients[0]; }
+
+        /// \brief defines the addition between two k-vectors of the same grade
+        /// \param mv2 - second operand
+        /// \return this + mv2
+        constexpr KVector operator+(const KVector &mv2) const {
+            KVector mv3;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv3.coefficients[i] = coefficients[i] + mv2.coefficients[i];
+            return mv3;
+        }
+
+        /// \brief defines the difference between two k-vectors of the same grade
+        /// \param mv2 - second operand
+        /// \return this - mv2
+        constexpr KVector operator-(const KVector &mv2) const {
+            KVector mv3;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv3.coefficients[i] = coefficients[i] - mv2.coefficients[i];
+            return mv3;
+        }
+
+        /// \brief defines the opposite of a k-vector
+        /// \return -this
+        constexpr KVector operator-() const {
+            KVector mv3;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv3.coefficients[i] = -coefficients[i];
+            return mv3;
+        }
+
+        /// \brief defines the product between a k-vector and a scalar
+        /// \param value - a scalar
+        /// \return this * value
+        constexpr KVector operator*(const T &value) const {
+            KVector mv3;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv3.coefficients[i] = coefficients[i] * value;
+            return mv3;
+        }
+
+        /// \brief defines the division of a k-vector by a scalar
+        /// \param value - a scalar
+        /// \return this / value
+        constexpr KVector operator/(const T &value) const {
+            KVector mv3;
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                mv3.coefficients[i] = coefficients[i] / value;
+            return mv3;
+        }
+
+        /// \brief the reverse of the k-vector, same signs as Mvec::reverse
+        /// \return the reverse of this
+        constexpr KVector reverse() const {
+            return (*this) * T(signReversePerGrade[K]);
+        }
+
+        /// \brief compare two k-vectors of the same grade
+        /// \param mv2 - second operand
+        /// \return true if all their coefficients are equal
+        constexpr bool operator==(const KVector &mv2) const {
+            for(unsigned int i=0; i<binomialArray[K]; ++i)
+                if(coefficients[i] != mv2.coefficients[i])
+                    return false;
+            return true;
+        }
+
+        /// \brief compare two k-vectors of the same grade
+        /// \param mv2 - second operand
+        /// \return true if one of their coefficients is different
+        constexpr bool operator!=(const KVector &mv2) const {
+            return !(*this == mv2);
+        }
+    };
+
+
+    template<typename T> using Vec0 = KVector<T, 0>; /*!< scalar */
+    template<typename T> using Vec1 = KVector<T, 1>; /*!< vector: point, dual sphere, dual plane */
+    template<typename T> using Vec2 = KVector<T, 2>; /*!< bivector: point pair, dual circle, dual line */
+    template<typename T> using Vec3 = KVector<T, 3>; /*!< trivector: circle, line, dual point pair */
+    template<typename T> using Vec4 = KVector<T, 4>; /*!< quadvector: sphere, plane */
+    template<typename T> using Vec5 = KVector<T, 5>; /*!< pseudoscalar */
+
+
+    /// \brief defines the product between a scalar and a k-vector
+    /// \param value - a scalar
+    /// \param mv - a k-vector
+    /// \return value * mv
+    template<typename T, unsigned int K>
+    constexpr KVector<T, K> operator*(const T &value, const KVector<T, K> &mv) {
+        return mv * value;
+    }
+
+    /// \brief defines the outer product between two k-vectors, computed by outer_GradeMv1_GradeMv2
+    /// \param mv1 - a k-vector of grade GradeMv1
+    /// \param mv2 - a k-vector of grade GradeMv2
+    /// \return mv1^mv2, of grade GradeMv1 + GradeMv2
+    template<typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    constexpr KVector<T, GradeMv1 + GradeMv2> operator^(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2) {
+        KVector<T, GradeMv1 + GradeMv2> mv3;
+        outerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3);
+        return mv3;
+    }
+
+    /// \brief defines the inner product between two k-vectors, computed by inner_GradeMv1_GradeMv2
+    /// \param mv1 - a k-vector of grade GradeMv1
+    /// \param mv2 - a k-vector of grade GradeMv2
+    /// \return mv1.mv2, of grade |GradeMv1 - GradeMv2| (0 if one of them is a scalar, as with Mvec)
+    template<typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    constexpr KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> operator|(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2) {
+        KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> mv3;
+        if constexpr(GradeMv1 != 0 && GradeMv2 != 0)
+            innerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3);
+        return mv3;
+    }
+
+    /// \brief defines the left contraction between two k-vectors
+    /// \param mv1 - a k-vector of grade GradeMv1
+    /// \param mv2 - a k-vector of grade GradeMv2
+    /// \return the left contraction, of grade |GradeMv1 - GradeMv2| (0 if GradeMv1 > GradeMv2)
+    template<typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    constexpr KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> operator<(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2) {
+        KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> mv3;
+        if constexpr(GradeMv1 <= GradeMv2)
+            innerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3);
+        return mv3;
+    }
+
+    /// \brief defines the right contraction between two k-vectors
+    /// \param mv1 - a k-vector of grade GradeMv1
+    /// \param mv2 - a k-vector of grade GradeMv2
+    /// \return the right contraction, of grade |GradeMv1 - GradeMv2| (0 if GradeMv1 < GradeMv2)
+    template<typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    constexpr KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> operator>(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2) {
+        KVector<T, (GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1)> mv3;
+        if constexpr(GradeMv1 >= GradeMv2)
+            innerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3);
+        return mv3;
+    }
+
+    /// \cond DEV
+    /// \brief add the part of grade GradeMv3 of the geometric product mv1 mv2 to mv3 (a grade whose product is neither the outer nor the inner product)
+    template<unsigned int GradeMv3, typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    inline void geometricGradeToMvec(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2, Mvec<T> &mv3) {
+        constexpr unsigned int gradeOuter = GradeMv1 + GradeMv2;
+        constexpr unsigned int gradeMax = (2*algebraDimension - gradeOuter + 1 < gradeOuter) ? 2*algebraDimension - gradeOuter + 1 : gradeOuter;
+        if constexpr(GradeMv3 < gradeMax){
+            geometricExplicit<GradeMv3, GradeMv1, GradeMv2, T>(mv1, mv2, mv3.createVectorXdIfDoesNotExist(GradeMv3));
+            mv3.removeGradeIfZero(GradeMv3);
+        }
+    }
+    /// \endcond
+
+    /// \brief defines the geometric product between two k-vectors, with the same explicit functions as Mvec::operator*
+    /// (selected at compile time). The result has several grades in general, so it is a Mvec.
+    /// \param mv1 - a k-vector of grade GradeMv1
+    /// \param mv2 - a k-vector of grade GradeMv2
+    /// \return mv1 mv2, equal to mv1.toMvec() * mv2.toMvec()
+    template<typename T, unsigned int GradeMv1, unsigned int GradeMv2>
+    Mvec<T> operator*(const KVector<T, GradeMv1> &mv1, const KVector<T, GradeMv2> &mv2) {
+        constexpr unsigned int gradeOuter = GradeMv1 + GradeMv2;
+        constexpr unsigned int gradeInner = GradeMv1 > GradeMv2 ? GradeMv1 - GradeMv2 : GradeMv2 - GradeMv1;
+        Mvec<T> mv3;
+        if constexpr(gradeOuter <= algebraDimension){
+            outerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3.createVectorXdIfDoesNotExist(gradeOuter));
+            mv3.removeGradeIfZero(gradeOuter);
+        }
+        if constexpr(gradeInner != gradeOuter){
+            innerExplicit<GradeMv1, GradeMv2, T>(mv1, mv2, mv3.createVectorXdIfDoesNotExist(gradeInner));
+            mv3.removeGradeIfZero(gradeInner);
+            geometricGradeToMvec<gradeInner + 2>(mv1, mv2, mv3); // at most two grades between the inner and the outer product in dimension 5
+            geometricGradeToMvec<gradeInner + 4>(mv1, mv2, mv3);
+        }
+        return mv3;
+    }
+
+}/// End of Namespace
+
+#endif // C3GA_K_VECTOR_HPP__
@@ -0,0 +1,344 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Lazy.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Lazy.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Lazy evaluation of expressions of multivectors (expression templates), in the Geometric algebra of c3ga.
+/// An expression is built from multivectors wrapped by c3ga::lazy, with the outer product (^), the inner product (|),
+/// the dual (!) and the grade projection (grade(k)). Nothing is computed until the expression is evaluated, then only
+/// the grades of the operands that contribute to the requested grades are computed, with the same explicit functions
+/// as Mvec and without any intermediate multivector. For instance:
+/// \code
+///     auto circle = c3ga::lazy(dualSphere1) ^ c3ga::lazy(dualSphere2);
+///     double square = (circle | circle).scalar(); // only the grade 2 of circle is computed, no Mvec is created
+/// \endcode
+/// The values are the same as with Mvec. The wrapped multivectors are referenced, they must outlive the expression.
+
+
+// Anti-doublon
+#ifndef C3GA_LAZY_HPP__
+#define C3GA_LAZY_HPP__
+#pragma once
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    constexpr unsigned int lazyBufferSize = binomialArray[algebraDimension/2]; /*!< size of the largest k-vector, used for the temporary k-vectors of an evaluation */
+
+    template<typename T, typename Expr> class LazyGrade;
+
+
+    /// \cond DEV
+    /// \brief test if two expressions compute the same values, as the two operands of (circle | circle): the expressions
+    /// of different types are considered as different
+    template<typename Expr1, typename Expr2>
+    inline bool sameLazyExpr(const Expr1 &, const Expr2 &){
+        return false;
+    }
+
+    template<typename Expr>
+    inline bool sameLazyExpr(const Expr &mv1, const Expr &mv2){
+        return mv1.sameAs(mv2);
+    }
+
+    /// \brief the grades of an operand needed by an evaluation, each one computed once
+    template<typename T>
+    struct LazyGrades {
+        T buffers[algebraDimension+1][lazyBufferSize];
+        const T *coefficients[algebraDimension+1];
+
+        /// \brief evaluate the given grades of an expression
+        /// \param mv - the expression
+        /// \param grades - bitmap of the grades to evaluate
+        template<typename Expr>
+        inline void eval(const Expr &mv, const unsigned int grades){
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                if(grades & (1<<grade))
+                    coefficients[grade] = mv.evalGrade(grade, buffers[grade]).data();
+        }
+
+        /// \brief the coefficients of an evaluated grade
+        inline ConstKvecRef<T> kvec(const unsigned int grade) const {
+            return ConstKvecRef<T>(coefficients[grade], binomialArray[grade]);
+        }
+    };
+    /// \endcond
+
+
+    /// \class LazyExpr
+    /// \brief base of the lazy expressions. Every expression Expr provides:
+    /// grades(), the bitmap of the grades that may be non-zero in its result,
+    /// evalGrade(grade, buffer), the coefficients of this grade of its result (computed in buffer if needed), and
+    /// sameAs(other), true if the expression other of the same type computes the same values (same referenced multivectors).
+    /// \tparam T - type of the coefficients
+    /// \tparam Expr - the expression
+    template<typename T, typename Expr>
+    class LazyExpr {
+    public:
+
+        /// \brief the expression
+        inline const Expr& expression() const {
+            return static_cast<const Expr&>(*this);
+        }
+
+        /// \brief grade projection of the expression
+        /// \param grade - the kept grade
+        /// \return the lazy expression of the part of grade "grade"
+        inline LazyGrade<T, Expr> grade(const unsigned int grade) const {
+            return LazyGrade<T, Expr>(expression(), grade);
+        }
+
+        /// \brief evaluate the scalar part of the expression (only what this grade needs is computed)
+        /// \return the scalar part of the result, 0 if the result has no scalar part
+        inline T scalar() const {
+            if(!(expression().grades() & 1))
+                return T(0);
+            T buffer[lazyBufferSize];
+            return expression().evalGrade(0, buffer).coeff(0);
+        }
+
+        /// \brief evaluate the whole expression (the grades whose coefficients are all zero are removed)
+        /// \return the multivector of the result
+        Mvec<T> eval() const {
+            Mvec<T> mv;
+            const unsigned int resultGrades = expression().grades();
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+                if(!(resultGrades & (1<<grade)))
+                    continue;
+                T buffer[lazyBufferSize];
+                mv.createVectorXdIfDoesNotExist(grade) = expression().evalGrade(grade, buffer);
+                mv.removeGradeIfZero(grade);
+            }
+            return mv;
+        }
+    };
+
+
+    /// \class LazyMvec
+    /// \brief lazy expression referencing a multivector, built by c3ga::lazy
+    template<typename T>
+    class LazyMvec : public LazyExpr<T, LazyMvec<T>> {
+    protected:
+        const Mvec<T> &mv;
+        unsigned int gradeBitmap;
+
+    public:
+        /// \param mv - the referenced multivector, it must outlive the expression
+        explicit LazyMvec(const Mvec<T> &mv) : mv(mv), gradeBitmap(0) {
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                if(!mv.isEmpty() && mv.isGrade(grade))
+                    gradeBitmap |= 1 << grade;
+        }
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline ConstKvecRef<T> evalGrade(const unsigned int grade, T*) const {
+            return mv.kvec(grade); // no copy
+        }
+
+        inline bool sameAs(const LazyMvec &other) const { return &mv == &other.mv; }
+    };
+
+
+    /// \class LazyOuter
+    /// \brief lazy expression of the outer product of two expressions
+    template<typename T, typename Expr1, typename Expr2>
+    class LazyOuter : public LazyExpr<T, LazyOuter<T, Expr1, Expr2>> {
+    protected:
+        Expr1 mv1;
+        Expr2 mv2;
+        unsigned int gradeBitmap;
+
+    public:
+        LazyOuter(const Expr1 &mv1, const Expr2 &mv2) : mv1(mv1), mv2(mv2), gradeBitmap(0) {
+            for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+                for(unsigned int grade2=0; grade1+grade2<=algebraDimension; ++grade2)
+                    if((mv1.grades() & (1<<grade1)) && (mv2.grades() & (1<<grade2)))
+                        gradeBitmap |= 1 << (grade1 + grade2);
+        }
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline bool sameAs(const LazyOuter &other) const { return sameLazyExpr(mv1, other.mv1) && sameLazyExpr(mv2, other.mv2); }
+
+        /// \brief same accumulation order as Mvec::operator^ (increasing grade of mv1), each grade of the operands is evaluated once
+        ConstKvecRef<T> evalGrade(const unsigned int grade, T *buffer) const {
+            unsigned int grades1 = 0, grades2 = 0;
+            for(unsigned int grade1=0; grade1<=grade; ++grade1){
+                const unsigned int grade2 = grade - grade1;
+                if((mv1.grades() & (1<<grade1)) && (mv2.grades() & (1<<grade2))){
+                    grades1 |= 1 << grade1;
+                    grades2 |= 1 << grade2;
+                }
+            }
+            LazyGrades<T> kvecs1, kvecs2;
+            const bool sameOperands = sameLazyExpr(mv1, mv2);
+            kvecs1.eval(mv1, sameOperands ? grades1 | grades2 : grades1);
+            if(!sameOperands)
+                kvecs2.eval(mv2, grades2);
+            const LazyGrades<T> &operand2 = sameOperands ? kvecs1 : kvecs2;
+
+            KvecRef<T> mv3(buffer, binomialArray[grade]);
+            mv3.setZero();
+            for(unsigned int grade1=0; grade1<=grade; ++grade1)
+                if((grades1 & (1<<grade1)) && (grades2 & (1<<(grade - grade1))))
+                    outerExplicitDispatch<T>(grade1, grade - grade1, kvecs1.kvec(grade1), operand2.kvec(grade - grade1), mv3);
+            return ConstKvecRef<T>(buffer, binomialArray[grade]);
+        }
+    };
+
+
+    /// \class LazyInner
+    /// \brief lazy expression of the inner product of two expressions
+    template<typename T, typename Expr1, typename Expr2>
+    class LazyInner : public LazyExpr<T, LazyInner<T, Expr1, Expr2>> {
+    protected:
+        Expr1 mv1;
+        Expr2 mv2;
+        unsigned int gradeBitmap;
+
+    public:
+        LazyInner(const Expr1 &mv1, const Expr2 &mv2) : mv1(mv1), mv2(mv2), gradeBitmap(0) {
+            for(unsigned int grade1=1; grade1<=algebraDimension; ++grade1) // inner between a mv and a scalar gives 0
+                for(unsigned int grade2=1; grade2<=algebraDimension; ++grade2)
+                    if((mv1.grades() & (1<<grade1)) && (mv2.grades() & (1<<grade2)))
+                        gradeBitmap |= 1 << (grade1 > grade2 ? grade1 - grade2 : grade2 - grade1);
+        }
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline bool sameAs(const LazyInner &other) const { return sameLazyExpr(mv1, other.mv1) && sameLazyExpr(mv2, other.mv2); }
+
+        /// \brief same accumulation order as Mvec::operator| (increasing grade of mv1, then of mv2), each grade of the operands is evaluated once
+        ConstKvecRef<T> evalGrade(const unsigned int grade, T *buffer) const {
+            // pairs of grades whose inner product has this grade: |grade1 - grade2| == grade
+            unsigned int pairs[algebraDimension+1] = {0}; // pairs[grade1], bitmap of the grades of mv2
+            unsigned int grades1 = 0, grades2 = 0;
+            for(unsigned int grade1=1; grade1<=algebraDimension; ++grade1){
+                if(!(mv1.grades() & (1<<grade1)))
+                    continue;
+                const int candidates[2] = {int(grade1) - int(grade), int(grade1 + grade)};
+                for(unsigned int c=0; c<(grade == 0 ? 1u : 2u); ++c)
+                    if(candidates[c] >= 1 && candidates[c] <= int(algebraDimension) && (mv2.grades() & (1<<candidates[c])))
+                        pairs[grade1] |= 1 << candidates[c];
+                if(pairs[grade1]){
+                    grades1 |= 1 << grade1;
+                    grades2 |= pairs[grade1];
+                }
+            }
+            LazyGrades<T> kvecs1, kvecs2;
+            const bool sameOperands = sameLazyExpr(mv1, mv2);
+            kvecs1.eval(mv1, sameOperands ? grades1 | grades2 : grades1);
+            if(!sameOperands)
+                kvecs2.eval(mv2, grades2);
+            const LazyGrades<T> &operand2 = sameOperands ? kvecs1 : kvecs2;
+
+            KvecRef<T> mv3(buffer, binomialArray[grade]);
+            mv3.setZero();
+            for(unsigned int grade1=1; grade1<=algebraDimension; ++grade1)
+                for(unsigned int grade2=1; grade2<=algebraDimension; ++grade2) // grade1 - grade, then grade1 + grade
+                    if(pairs[grade1] & (1<<grade2))
+                        innerExplicitDispatch<T>(grade1, grade2, kvecs1.kvec(grade1), operand2.kvec(grade2), mv3);
+            return ConstKvecRef<T>(buffer, binomialArray[grade]);
+        }
+    };
+
+
+    /// \class LazyDual
+    /// \brief lazy expression of the dual of an expression
+    template<typename T, typename Expr>
+    class LazyDual : public LazyExpr<T, LazyDual<T, Expr>> {
+    protected:
+        Expr mv;
+        unsigned int gradeBitmap;
+
+    public:
+        explicit LazyDual(const Expr &mv) : mv(mv), gradeBitmap(0) {
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                if(mv.grades() & (1<<grade))
+                    gradeBitmap |= 1 << (algebraDimension - grade);
+        }
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline bool sameAs(const LazyDual &other) const { return sameLazyExpr(mv, other.mv); }
+
+        /// \brief same operations as Mvec::dual on the grade algebraDimension - grade of the expression
+        ConstKvecRef<T> evalGrade(const unsigned int grade, T *buffer) const {
+            const unsigned int primalGrade = algebraDimension - grade;
+            T primalBuffer[lazyBufferSize];
+            ConstKvecRef<T> primalKvec = mv.evalGrade(primalGrade, primalBuffer);
+            KvecRef<T> dualKvec(buffer, binomialArray[grade]);
+            for(unsigned int i=0; i<binomialArray[primalGrade]; ++i)
+                dualKvec.coeffRef(dualPermutations[primalGrade][i]) = primalKvec.coeff(i);
+            for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                dualKvec.coeffRef(i) *= T(dualCoefficients[primalGrade].coeff(i));
+            return ConstKvecRef<T>(buffer, binomialArray[grade]);
+        }
+    };
+
+
+    /// \class LazyGrade
+    /// \brief lazy expression of the grade projection of an expression
+    template<typename T, typename Expr>
+    class LazyGrade : public LazyExpr<T, LazyGrade<T, Expr>> {
+    protected:
+        Expr mv;
+        unsigned int gradeBitmap;
+
+    public:
+        LazyGrade(const Expr &mv, const unsigned int grade) : mv(mv), gradeBitmap(mv.grades() & (1<<grade)) {}
+
+        inline unsigned int grades() const { return gradeBitmap; }
+
+        inline bool sameAs(const LazyGrade &other) const { return gradeBitmap == other.gradeBitmap && sameLazyExpr(mv, other.mv); }
+
+        inline ConstKvecRef<T> evalGrade(const unsigned int grade, T *buffer) const {
+            return mv.evalGrade(grade, buffer); // only called for the kept grade
+        }
+    };
+
+
+    /// \brief start a lazy expression from a multivector
+    /// \param mv - the multivector, referenced by the expression: it must outlive the expression
+    /// \return the lazy expression of mv
+    template<typename T>
+    inline LazyMvec<T> lazy(const Mvec<T> &mv){
+        return LazyMvec<T>(mv);
+    }
+
+    template<typename T>
+    LazyMvec<T> lazy(const Mvec<T> &&mv) = delete; // the temporary would be destroyed before the evaluation
+
+    /// \brief lazy outer product between two expressions
+    template<typename T, typename Expr1, typename Expr2>
+    inline LazyOuter<T, Expr1, Expr2> operator^(const LazyExpr<T, Expr1> &mv1, const LazyExpr<T, Expr2> &mv2){
+        return LazyOuter<T, Expr1, Expr2>(mv1.expression(), mv2.expression());
+    }
+
+    /// \brief lazy inner product between two expressions
+    template<typename T, typename Expr1, typename Expr2>
+    inline LazyInner<T, Expr1, Expr2> operator|(const LazyExpr<T, Expr1> &mv1, const LazyExpr<T, Expr2> &mv2){
+        return LazyInner<T, Expr1, Expr2>(mv1.expression(), mv2.expression());
+    }
+
+    /// \brief lazy dual of an expression
+    template<typename T, typename Expr>
+    inline LazyDual<T, Expr> operator!(const LazyExpr<T, Expr> &mv){
+        return LazyDual<T, Expr>(mv.expression());
+    }
+
+}/// End of Namespace
+
+#endif // C3GA_LAZY_HPP__
@@ -19,7 +19,7 @@
 
 // External Includes
 #include <Eigen/Core>
-#include <list>
+#include <array>
 #include <iostream>
 #include <cmath>
 #include <limits>
@@ -42,30 +42,16 @@
 namespace c3ga{
 
 
-    /// \class Kvec
-    /// \brief class defining a single grade component of a multivector.
-    template<class T>
-    struct Kvec{
-
-        Eigen::Matrix<T, Eigen::Dynamic, 1> vec;  /*!< dynamic vector of Eigen Library */
-
-        unsigned int grade; /*!< grade k of the k-vector */
-
-        /// \brief operator == to test the equality between 2 k-vectors.
-        bool operator == (const Kvec<T>& other) const {
-            return vec == other.vec;
-        }
-    };
-
-
-
     /// \class Mvec
     /// \brief class defining multivectors.
+    /// The coefficients are stored inline, without any heap allocation: each grade k has its own fixed slot of
+    /// binomialArray[k] coefficients starting at perGradeStartingIndex[k], and gradeBitmap tells which slots are used.
+    /// The slots of the grades that are not contained in the multivector are always full of zeros.
     template<typename T = double>
     class Mvec {
 
     protected:
-        std::list<Kvec<T>> mvData;  /*!< set of k-vectors, mapped by grade */
+        std::array<T, nbCoefficients> mvData; /*!< coefficients of the multivector, one slot per grade */
         unsigned int gradeBitmap;   /*!< ith bit to 1 if grade i is contained in the multivector */
 
     public:
@@ -183,6 +169,10 @@ namespace c3ga{
         /// \return this ^= mv
         Mvec& operator^=(const Mvec& mv);
 
+        /// \brief outer product written in a given multivector, see c3ga::outer
+        template<typename U>
+        friend void outer(Mvec<U> &mv3, const Mvec<U> &mv1, const Mvec<U> &mv2);
+
         /// \brief defines the inner product between two multivectors
         /// \param mv2 - a multivector
         /// \return this.mv2
@@ -206,6 +196,10 @@ namespace c3ga{
         /// \return this |= mv
         Mvec& operator|=(const Mvec& mv);
 
+        /// \brief inner product written in a given multivector, see c3ga::inner
+        template<typename U>
+        friend void inner(Mvec<U> &mv3, const Mvec<U> &mv1, const Mvec<U> &mv2);
+
         /// \brief defines the right contraction between two multivectors
         /// \param mv2 - a multivector
         /// \return the right contraction : $this \\lfloor mv2$
@@ -270,6 +264,18 @@ namespace c3ga{
         /// \return a scalar
         Mvec<T> scalarProduct(const Mvec<T> &mv2) const;
 
+        /// \brief compute only the part of grade "grade" of the geometric product between two multivectors,
+        /// the other grades of the product are neither computed nor stored
+        /// \param grade - the computed grade
+        /// \param mv2 - a multivector
+        /// \return (mv1*mv2).grade(grade), with the same values
+        Mvec<T> productGrade(const unsigned int grade, const Mvec<T> &mv2) const;
+
+        /// \brief compute only the scalar part of the geometric product between two multivectors, without any multivector
+        /// \param mv2 - a multivector
+        /// \return the scalar part of mv1*mv2, the same value as T(mv1.scalarProduct(mv2))
+        T productScalar(const Mvec<T> &mv2) const;
+
         /// \brief defines the dot product between two multivectors (Inner product + scalar product)
         /// \param mv2 - a multivector
         /// \return a multivector.
@@ -293,6 +299,10 @@ namespace c3ga{
         /// \return this *= mv
         Mvec& operator*=(const Mvec& mv);
 
+        /// \brief geometric product written in a given multivector, see c3ga::geometric
+        template<typename U>
+        friend void geometric(Mvec<U> &mv3, const Mvec<U> &mv1, const Mvec<U> &mv2);
+
         /// \brief defines the geometric product with a multivector and the inverse of a second multivector
         /// \param mv2 - a multivector
         /// \return this / mv2
@@ -343,7 +353,7 @@ namespace c3ga{
             if(gradeBitmap != mv2.gradeBitmap)
                 return false;
 
-            return mvData == mv2.mvData;   //// list : ca marche que si les listes sont ordonnees
+            return mvData == mv2.mvData; // the slots of the missing grades are zero in both multivectors
         }
 
         /// \brief compute the inverse of a multivector
@@ -374,7 +384,7 @@ namespace c3ga{
                 return 0;
 
             // assuming now that the scalar part exists, return it
-            return findGrade(0)->vec[0];
+            return mvData[0];
         }
 
         /// \brief Overload the [] operator to assign a basis blade to a multivector. As an example, float a = mv[E12] = 42.
@@ -386,32 +396,9 @@ namespace c3ga{
             const unsigned int grade = xorIndexToGrade[idx];
             const unsigned int idxHomogeneous = xorIndexToHomogeneousIndex[idx];
 
-            auto it = mvData.begin();
-            while(it != mvData.end()){
-
-                // if grade not reach yet, continue
-                if(it->grade < grade)
-                    ++it;
-                else{
-
-                    // if grade found
-                    if(it->grade == grade)
-                        return it->vec[idxHomogeneous];
-
-                    // if grade exceed, create it and inster it before the current element
-                    Kvec<T> kvec = {Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]),grade};
-                    auto it2 = mvData.insert(it,kvec);
-                    gradeBitmap |= 1 << (grade);
-                    return it2->vec[idxHomogeneous];
-                }
-            }
-
-            // if the searched element should be added at the end, add it
-            Kvec<T> kvec = {Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]),grade};
-
-            auto it2 = mvData.insert(mvData.end(),kvec);
+            // the slot of the grade is already full of zeros if the grade was not contained yet
             gradeBitmap |= 1 << (grade);
-            return it2->vec[idxHomogeneous];
+            return mvData[perGradeStartingIndex[grade] + idxHomogeneous];
         }
 
         /// \brief Overload the [] operator to copy a basis blade of this multivector. As an example, float a = mv[E12].
@@ -422,25 +409,8 @@ namespace c3ga{
             const unsigned int grade = xorIndexToGrade[idx];
             const unsigned int idxHomogeneous = xorIndexToHomogeneousIndex[idx];
 
-            auto it = mvData.begin();
-            while(it != mvData.end()){
-
-                // if grade not reach yet, continue
-                if(it->grade < grade)
-                    ++it;
-                else{
-
-                    // if grade found
-                    if(it->grade == grade)
-                        return it->vec[idxHomogeneous];
-
-                    // if grade exceed, return a reference on zero
-                    return zero<T>;
-                }
-            }
-
-            // searched element not found
-            return zero<T>;
+            // zero if the grade is not contained in the multivector
+            return mvData[perGradeStartingIndex[grade] + idxHomogeneous];
         }
 
 /*
@@ -476,12 +446,8 @@ namespace c3ga{
         /// \param grade : grade of the component to enable
         /// \param index : index of the parameter in the k-vector (k = grade)
         inline Mvec componentToOne(const unsigned int grade, const int index){
-            Kvec<T> kvec;
-			kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
-			kvec.grade=grade;
-            kvec.vec[index] = T(1);
             Mvec mv1;
-            mv1.mvData.push_back(kvec);
+            mv1.mvData[perGradeStartingIndex[grade] + index] = T(1);
             mv1.gradeBitmap = 1 << (grade);
 
             return mv1;
@@ -489,42 +455,45 @@ namespace c3ga{
         /// \endcond // do not comment this functions
 
         /// \cond DEV
-        /// \brief create a VectorXd if it has not yet been created
+        /// \brief view on the coefficients of grade "grade" (full of zeros if the grade is not contained in the multivector)
         /// \param grade - grade of the considered kvector
-        /// \return nothing
-        inline typename std::list<Kvec<T>>::iterator createVectorXdIfDoesNotExist(const unsigned int grade){
-
-            auto it = mvData.begin();
-            while(it != mvData.end()){
-
-                // if grade not reach yet, continue
-                if(it->grade < grade)
-                    ++it;
-                else{
-
-                    // if grade found
-                    if(it->grade == grade)
-                        return it;
-
-                    // if grade exceed, create it and inster it before the current element
-                    Kvec<T> kvec;
-					kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
-					kvec.grade=grade;
-                    auto it2 = mvData.insert(it,kvec);
-                    gradeBitmap |= 1 << (grade);
-                    return it2;
-                }
-            }
+        /// \return a view on the slot of this grade
+        inline KvecRef<T> kvec(const unsigned int grade){
+            return KvecRef<T>(mvData.data() + perGradeStartingIndex[grade], binomialArray[grade]);
+        }
 
-            // if the searched element should be added at the end, add it
-            Kvec<T> kvec;
-			kvec.vec=Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[grade]);
-			kvec.grade=grade;
-            auto it2 = mvData.insert(mvData.end(),kvec);
+        /// \brief read-only view on the coefficients of grade "grade" (full of zeros if the grade is not contained in the multivector)
+        /// \param grade - grade of the considered kvector
+        /// \return a view on the slot of this grade
+        inline ConstKvecRef<T> kvec(const unsigned int grade) const{
+            return ConstKvecRef<T>(mvData.data() + perGradeStartingIndex[grade], binomialArray[grade]);
+        }
+
+        /// \brief add a grade to the multivector if it is not yet contained (its coefficients are zero)
+        /// \param grade - grade of the considered kvector
+        /// \return a view on the slot of this grade
+        inline KvecRef<T> createVectorXdIfDoesNotExist(const unsigned int grade){
             gradeBitmap |= 1 << (grade);
-            return it2;
+            return kvec(grade);
+        }
+
+        /// \brief remove a grade of the multivector if all its coefficients are zero
+        /// \param grade - grade of the considered kvector
+        inline void removeGradeIfZero(const unsigned int grade){
+            KvecRef<T> coefficients = kvec(grade);
+            if(!((coefficients.array() != 0.0).any())){
+                coefficients.setZero(); // -0.0 become 0.0
+                gradeBitmap &= ~(1 << grade);
+            }
         }
 
+        /// \brief add the part of grade "grade" of the geometric product between this multivector and mv2 to mv3
+        /// \param grade - the computed grade
+        /// \param mv2 - a multivector
+        /// \param mv3 - binomialArray[grade] coefficients, the result is added to them
+        void productGradeAccumulate(const unsigned int grade, const Mvec<T> &mv2, KvecRef<T> mv3) const;
+        /// \endcond // do not comment this functions
+
 
         /// \cond DEV
         /// \brief modify the element of the multivector whose grade is "grade"
@@ -532,8 +501,8 @@ namespace c3ga{
         /// \param indexVectorXd : index of the k-vector (with k = "grade")
         /// \return the element of the Mv whose grade is grade and index in the VectorXd is indexVectorXd
         inline T& at(const int grade, const int indexVectorXd){
-            auto it = createVectorXdIfDoesNotExist(grade);
-            return it->vec.coeffRef(indexVectorXd);  
+            gradeBitmap |= 1 << (grade);
+            return mvData[perGradeStartingIndex[grade] + indexVectorXd];
         }
         /// \endcond // do not comment this functions
 
@@ -543,19 +512,14 @@ namespace c3ga{
         /// \param indexVectorXd : index of the k-vector (with k = "grade")
         /// \return the element of the Mv whose grade is grade and index in the VectorXd is indexVectorXd
         inline T at(const int grade, const int indexVectorXd) const{
-
-            if((gradeBitmap & (1<<(grade))) == 0 )
-                return T(0);
-
-            auto it = findGrade(grade);
-            return it->vec.coeff(indexVectorXd);
+            return mvData[perGradeStartingIndex[grade] + indexVectorXd]; // zero if the grade is not contained
         }
         /// \endcond // do not comment this functions
 
         /// \brief the L2-norm of the mv is sqrt( abs( mv.mv ) )
         /// \return the L2-norm of the multivector (as a double)
         T inline norm() const {
-            return sqrt( fabs( (*this).scalarProduct( this->reverse() ) ));
+            return sqrt( fabs( (*this).productScalar( this->reverse() ) ));
         }
 
         /// \brief the L2-norm over 2 of the mv is mv.mv
@@ -568,36 +532,21 @@ namespace c3ga{
         /// \return - the dual of the multivector
         Mvec<T> dual() const;
 
+        /// \brief dual written in a given multivector, see c3ga::dual
+        template<typename U>
+        friend void dual(Mvec<U> &dualMv, const Mvec<U> &mv);
+
         /// \brief compute the reverse of a multivector
         /// \return - the reverse of the multivector
         Mvec<T> reverse() const;
 
-        /// \brief search in the multivector for a Kvec of grade "grade"
-        /// \return return a const iterator on the Kvec if exist, else return mvData.end()
-        inline typename std::list<Kvec<T>>::const_iterator findGrade(const unsigned int & gradeToFind) const {
-            for(auto it = mvData.begin();it != mvData.end();++it){
-                if(it->grade==gradeToFind){
-                    return it;
-                }
-            }
-            return mvData.end();
-        }
-
-        /// \brief search in the multivector for a Kvec of grade "grade"
-        /// \return return an iterator on the Kvec if exist, else return mvData.end()
-        inline typename std::list<Kvec<T>>::iterator findGrade(const unsigned int & gradeToFind) {
-            for(auto it = mvData.begin();it != mvData.end();++it){
-                if(it->grade==gradeToFind){
-                    return it;
-                }
-            }
-            return mvData.end();
-        }
-
         /// \brief return the (highest) grade of the multivector
         /// \return the highest grade of the multivector
         inline int grade() const {
-            return (mvData.begin() == mvData.end()) ? 0 : mvData.rbegin()->grade;
+            for(int i=algebraDimension; i>0; --i)
+                if(gradeBitmap & (1<<i))
+                    return i;
+            return 0;
         }
 
         /// \brief return the all non-zero grades of the multivector (several grades for non-homogeneous multivectors)
@@ -623,13 +572,13 @@ namespace c3ga{
         /// \brief check is a mutivector is empty, i.e. corresponds to 0.
         /// \return True if the multivector is empty, else False.
         inline bool isEmpty() const {
-            return mvData.empty();
+            return gradeBitmap == 0;
         }
 
         /// \brief A multivector is homogeneous if all its components have the same grade.
         /// \return True if the multivector is homogeneous, else False.
         inline bool isHomogeneous() const {
-            return mvData.size() < 2; // only one element, or zero element on the list
+            return (gradeBitmap & (gradeBitmap - 1)) == 0; // only one grade, or no grade at all
         }
 
         /// \brief inplace simplify the multivector such that all the values with a magnitude lower than a epsilon in the Mv are set to 0.
@@ -654,7 +603,7 @@ namespace c3ga{
         /// \param gradeMV - the considered grade
         /// \param moreThanOne - true if it the first element to display (should we put a '+' before)
         template<typename U>
-        friend void traverseKVector(std::ostream &stream, const Eigen::Matrix<U, Eigen::Dynamic, 1>, unsigned int gradeMV, bool& moreThanOne);
+        friend void traverseKVector(std::ostream &stream, const ConstKvecRef<U> kvector, unsigned int gradeMV, bool& moreThanOne);
         /// \endcond // do not comment this functions
 
 /*
@@ -691,12 +640,11 @@ namespace c3ga{
         /// \return a new mv with the right component at the right place
         Mvec extractOneComponent(const int grade, const int sizeOfKVector, const int indexInKvector) const {
             Mvec mv;
-            auto itThisMV = this->findGrade(grade);
-            if(itThisMV==this->mvData.end()){
+            if((gradeBitmap & (1<<grade)) == 0){
                 return mv;
             }
             mv = mv.componentToOne(grade,indexInKvector);
-            mv.mvData.begin()->vec.coeffRef(indexInKvector) = itThisMV->vec.coeff(indexInKvector);
+            mv.mvData[perGradeStartingIndex[grade] + indexInKvector] = mvData[perGradeStartingIndex[grade] + indexInKvector];
             return mv;
         }
 
@@ -738,11 +686,43 @@ namespace c3ga{
     };  // end of the class definition
 
 
+    /// \brief compute the outer product between two multivectors in a given multivector, without any temporary multivector
+    /// (except if mv3 is also an operand)
+    /// \param mv3 - output, its previous content is replaced by mv1 ^ mv2
+    /// \param mv1 - a multivector
+    /// \param mv2 - a multivector
+    template<typename T>
+    void outer(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2);
+
+    /// \brief compute the inner product between two multivectors in a given multivector, without any temporary multivector
+    /// (except if mv3 is also an operand)
+    /// \param mv3 - output, its previous content is replaced by mv1 | mv2
+    /// \param mv1 - a multivector
+    /// \param mv2 - a multivector
+    template<typename T>
+    void inner(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2);
+
+    /// \brief compute the geometric product between two multivectors in a given multivector, without any temporary multivector
+    /// (except if mv3 is also an operand)
+    /// \param mv3 - output, its previous content is replaced by mv1 * mv2
+    /// \param mv1 - a multivector
+    /// \param mv2 - a multivector
+    template<typename T>
+    void geometric(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2);
+
+    /// \brief compute the dual of a multivector in a given multivector, without any temporary multivector
+    /// (except if dualMv is also mv)
+    /// \param dualMv - output, its previous content is replaced by mv.dual()
+    /// \param mv - a multivector
+    template<typename T>
+    void dual(Mvec<T> &dualMv, const Mvec<T> &mv);
+
+
     /* ------------------------------------------------------------------------------------------------ */
 
 
     template<typename T>
-    Mvec<T>::Mvec():gradeBitmap(0)
+    Mvec<T>::Mvec():mvData(),gradeBitmap(0)
     {}
 
 
@@ -754,9 +734,9 @@ namespace c3ga{
 
 
     template<typename T>
-    Mvec<T>::Mvec(Mvec<T>&& multivector) : mvData(std::move(multivector.mvData)), gradeBitmap(multivector.gradeBitmap)
+    Mvec<T>::Mvec(Mvec<T>&& multivector) : mvData(multivector.mvData), gradeBitmap(multivector.gradeBitmap)
     {
-        // the move constructor
+        // the move constructor (the coefficients are stored inline, there is nothing to steal)
         //std::cout << "move constructor" << std::endl;
     }
 
@@ -765,27 +745,17 @@ namespace c3ga{
     template<typename U>
     Mvec<T>::Mvec(const Mvec<U> &mv) : gradeBitmap(mv.gradeBitmap)
     {
-        for(auto it=mv.mvData.begin(); it != mv.mvData.end(); ++it){
-            Kvec<T> kvec;
-            kvec.grade = it->grade;
-            kvec.vec = Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(binomialArray[it->grade]);
-            for(unsigned int i=0; i<it->vec.size(); ++i)
-                kvec.vec.coeffRef(i) = T(it->vec.coeff(i));
-            mvData.push_back(kvec);
-        }
+        for(unsigned int i=0; i<nbCoefficients; ++i)
+            mvData[i] = T(mv.mvData[i]);
     }
 
 
     template<typename T>
     template<typename U>
-    Mvec<T>::Mvec(const U val) {
+    Mvec<T>::Mvec(const U val) : mvData(), gradeBitmap(0) {
         if(val != U(0)) {
             gradeBitmap = 1;
-            Kvec<T> kvec;
-            kvec.vec =Eigen::Matrix<T, Eigen::Dynamic, 1>(1);
-            kvec.grade =0;
-            mvData.push_back(kvec);
-            mvData.begin()->vec.coeffRef(0) = val;
+            mvData[0] = val;
         }
     }
 
@@ -806,7 +776,7 @@ namespace c3ga{
 
     template<typename T>
     Mvec<T>& Mvec<T>::operator=(Mvec&& mv){
-        mvData = std::move(mv.mvData);
+        mvData = mv.mvData;
         gradeBitmap = mv.gradeBitmap;
         return *this;
     }
@@ -815,10 +785,9 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::operator+(const Mvec<T> &mv2) const {
         Mvec<T> mv3(*this);
-        for(auto & itMv : mv2.mvData) {
-            auto it = mv3.createVectorXdIfDoesNotExist(itMv.grade);
-            it->vec += itMv.vec;
-        }
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv2.gradeBitmap & (1<<grade))
+                mv3.createVectorXdIfDoesNotExist(grade) += mv2.kvec(grade);
         return mv3;
     }
 
@@ -834,8 +803,7 @@ namespace c3ga{
     Mvec<T> Mvec<T>::operator+(const S &value) const {
         Mvec<T> mv(*this);
         if(value != T(0)) {
-            auto it = mv.createVectorXdIfDoesNotExist(0);
-            it->vec.coeffRef(0) += value;
+            mv.createVectorXdIfDoesNotExist(0).coeffRef(0) += value;
         }
         return mv;
     }
@@ -851,8 +819,9 @@ namespace c3ga{
     template<typename T>
     Mvec<T> operator-(const Mvec<T> &mv) { // unary -
         Mvec<T> mv2(mv);
-        for(auto & itMv : mv2.mvData)
-            itMv.vec = -itMv.vec;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv2.gradeBitmap & (1<<grade))
+                mv2.kvec(grade) = -mv2.kvec(grade);
         return mv2;
     }
 
@@ -860,10 +829,9 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::operator-(const Mvec<T> &mv2) const {
         Mvec<T> mv3(*this);
-        for(auto & itMv : mv2.mvData) {
-            auto it = mv3.createVectorXdIfDoesNotExist(itMv.grade);
-            it->vec -= itMv.vec;
-        }
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv2.gradeBitmap & (1<<grade))
+                mv3.createVectorXdIfDoesNotExist(grade) -= mv2.kvec(grade);
         return mv3;
     }
 
@@ -886,8 +854,7 @@ namespace c3ga{
     Mvec<T> Mvec<T>::operator-(const S &value) const {
         Mvec<T> mv(*this);
         if(value != T(0)) {
-            auto it = mv.createVectorXdIfDoesNotExist(0);
-            it->vec.coeffRef(0) -= value;
+            mv.createVectorXdIfDoesNotExist(0).coeffRef(0) -= value;
         }
         return mv;
     }
@@ -900,32 +867,49 @@ namespace c3ga{
         // This version (with recursive call) is only faster than the standard recursive call if
         // the multivector mv1 and mv2 are homogeneous or near from homogeneous.
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)    // all per-grade component of mv1
-            for(const auto & itMv2 : mv2.mvData)  // all per-grade component of mv2
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)    // all per-grade component of mv1
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2)  // all per-grade component of mv2
             {
-                unsigned int grade_mv3 = itMv1.grade + itMv2.grade;
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+                unsigned int grade_mv3 = grade1 + grade2;
                 if(grade_mv3 <= algebraDimension) {
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade_mv3);
-                    outerProductHomogeneous(itMv1.vec, itMv2.vec, itMv3->vec,
-                                            itMv1.grade, itMv2.grade, grade_mv3);
+                    outerProductHomogeneous<T>(kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(grade_mv3),
+                                               grade1, grade2, grade_mv3);
                 }
             }
         return mv3;
 #else // use the adaptative pointer function array
-        // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled outer function using the functions pointer called outerFunctionsContainer
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
-                if(itMv1.grade + itMv2.grade <= (int) algebraDimension ){
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(itMv1.grade + itMv2.grade);
-                    outerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
-                }
-            }
+        c3ga::outer(mv3, *this, mv2);
         return mv3;
 #endif
     }
 
+
+    template<typename T>
+    void outer(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2){
+        // the operands are read during the whole product
+        if(&mv3 == &mv1 || &mv3 == &mv2){
+            Mvec<T> result;
+            outer(result, mv1, mv2);
+            mv3 = result;
+            return;
+        }
+
+        // Loop over non-empty grade of mv1 and mv2
+        // call the right explicit unrolled outer function selected by outerExplicitDispatch
+        mv3.clear();
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(mv1.gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+                if(grade1 + grade2 <= algebraDimension){
+                    outerExplicitDispatch<T>(grade1, grade2, mv1.kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(grade1 + grade2));
+                }
+            }
+    }
+
     template<typename U, typename S>
     Mvec<U> operator^(const S &value, const Mvec<U> &mv) {
         return  mv^value;
@@ -936,43 +920,57 @@ namespace c3ga{
     template<typename S>
     Mvec<T> Mvec<T>::operator^(const S &value) const {
         Mvec<T> mv2(*this);
-        for(auto & itMv : mv2.mvData)
-            itMv.vec *= T(value);
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv2.gradeBitmap & (1<<grade))
+                mv2.kvec(grade) *= T(value);
         return mv2;
     }
 
 
     template<typename T>
     Mvec<T> &Mvec<T>::operator^=(const Mvec &mv) {
-        *this = *this ^ mv;
+        c3ga::outer(*this, *this, mv);
         return *this;
     }
 
 
     template<typename T>
     Mvec<T> Mvec<T>::operator|(const Mvec<T> &mv2) const{
-        // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
+        c3ga::inner(mv3, *this, mv2);
+        return mv3;
+    }
+
+
+    template<typename T>
+    void inner(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2){
+        // the operands are read during the whole product
+        if(&mv3 == &mv1 || &mv3 == &mv2){
+            Mvec<T> result;
+            inner(result, mv1, mv2);
+            mv3 = result;
+            return;
+        }
+
+        // Loop over non-empty grade of mv1 and mv2
+        // call the right explicit unrolled inner function selected by innerExplicitDispatch
+        mv3.clear();
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(mv1.gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
 
                 // inner between a mv and a scalar gives 0
-                if(itMv1.grade*itMv2.grade == 0)
+                if(grade1*grade2 == 0)
                     continue;
 
                 // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                int absGradeMv3 = std::abs((int)(grade1 - grade2));
+                innerExplicitDispatch<T>(grade1, grade2, mv1.kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(absGradeMv3));
 
                 // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
+                mv3.removeGradeIfZero(absGradeMv3);
             }
-        return mv3;
     }
 
 
@@ -991,7 +989,7 @@ namespace c3ga{
 
     template<typename T>
     Mvec<T> &Mvec<T>::operator|=(const Mvec &mv) {
-        *this = *this | mv;
+        c3ga::inner(*this, *this, mv);
         return *this;
     }
 
@@ -999,25 +997,23 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::operator>(const Mvec<T> &mv2) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function selected by innerExplicitDispatch
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
 
                 // right contraction constraint: gradeMv1 >= gradeMv2
-                if(itMv1.grade < itMv2.grade)
+                if(grade1 < grade2)
                     continue;
 
                 // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                int absGradeMv3 = std::abs((int)(grade1 - grade2));
+                innerExplicitDispatch<T>(grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(absGradeMv3));
 
                 // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
+                mv3.removeGradeIfZero(absGradeMv3);
             }
 
         return mv3;
@@ -1027,7 +1023,7 @@ namespace c3ga{
     template<typename U, typename S>
     Mvec<U> operator>(const S &value, const Mvec<U> &mv) {
         if( (mv.gradeBitmap & 1) == 0) return Mvec<U>();
-        else return Mvec<U>( U(mv.mvData.begin()->vec.coeff(0) * value ) );
+        else return Mvec<U>( U(mv.mvData[0] * value ) );
     }
 
 
@@ -1036,8 +1032,9 @@ namespace c3ga{
     Mvec<T> Mvec<T>::operator>(const S &value) const {
         // return mv x value
         Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
-            itMv.vec *= T(value);
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv.gradeBitmap & (1<<grade))
+                mv.kvec(grade) *= T(value);
         return mv;
     }
 
@@ -1046,25 +1043,23 @@ namespace c3ga{
     Mvec<T> Mvec<T>::operator<(const Mvec<T> &mv2) const{
 
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function selected by innerExplicitDispatch
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
 
                 // left contraction constraint: gradeMv1 <= gradeMv2
-                if(itMv1.grade > itMv2.grade)
+                if(grade1 > grade2)
                     continue;
 
                 // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                int absGradeMv3 = std::abs((int)(grade1 - grade2));
+                innerExplicitDispatch<T>(grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(absGradeMv3));
 
                 // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
+                mv3.removeGradeIfZero(absGradeMv3);
             }
         return mv3;
     }
@@ -1074,8 +1069,9 @@ namespace c3ga{
     Mvec<U> operator<(const S &value, const Mvec<U> &mv) {
         // return mv x value
         Mvec<U> mv3(mv);
-        for(auto & itMv : mv3.mvData)
-            itMv.vec *= U(value);
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv3.gradeBitmap & (1<<grade))
+                mv3.kvec(grade) *= U(value);
         return mv3;
     }
 
@@ -1084,32 +1080,26 @@ namespace c3ga{
     template<typename S>
     Mvec<T> Mvec<T>::operator<(const S &value) const {
         if( (gradeBitmap & 1) == 0) return Mvec<T>();
-        else return Mvec<T>( T(mvData.begin()->vec.coeff(0) * value ) );
+        else return Mvec<T>( T(mvData[0] * value ) );
     }
 
 
     template<typename T>
     Mvec<T> Mvec<T>::scalarProduct(const Mvec<T> &mv2) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function selected by innerExplicitDispatch
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
-
-                if(itMv1.grade != itMv2.grade)
-                    continue;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+            if(!(gradeBitmap & (1<<grade)) || !(mv2.gradeBitmap & (1<<grade)))
+                continue;
 
-                // perform the inner product
-                int absGradeMv3 = 0;
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+            // perform the inner product
+            int absGradeMv3 = 0;
+            innerExplicitDispatch<T>(grade, grade, kvec(grade), mv2.kvec(grade), mv3.createVectorXdIfDoesNotExist(absGradeMv3));
 
-                // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
-            }
+            // check if the result is non-zero
+            mv3.removeGradeIfZero(absGradeMv3);
+        }
         return mv3;
     }
 
@@ -1119,21 +1109,19 @@ namespace c3ga{
     Mvec<T> Mvec<T>::outerPrimalDual(const Mvec<T> &mv2) const{
         Mvec<T> mv3;
 
-        for(const auto & itMv1 : this->mvData)    // all per-grade component of mv1
-            for(const auto & itMv2 : mv2.mvData)  // all per-grade component of mv2
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)    // all per-grade component of mv1
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2)  // all per-grade component of mv2
             {
-                unsigned int grade_mv3 = itMv1.grade + (algebraDimension-itMv2.grade);
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+                unsigned int grade_mv3 = grade1 + (algebraDimension-grade2);
                 if(grade_mv3 <= algebraDimension) {
                     // handle the scalar product as well as the left contraction
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade_mv3);
-                    outerProductPrimalDual(itMv1.vec, itMv2.vec, itMv3->vec,
-                                           itMv1.grade, itMv2.grade, (unsigned)(algebraDimension-grade_mv3));
+                    outerProductPrimalDual<T>(kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(grade_mv3),
+                                              grade1, grade2, (unsigned)(algebraDimension-grade_mv3));
 
                     // check if the result is non-zero
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<grade_mv3);
-                    }
+                    mv3.removeGradeIfZero(grade_mv3);
                 }
             }
 
@@ -1144,21 +1132,19 @@ namespace c3ga{
     Mvec<T> Mvec<T>::outerDualPrimal(const Mvec<T> &mv2) const{
         Mvec<T> mv3;
 
-        for(const auto & itMv1 : this->mvData)    // all per-grade component of mv1
-            for(const auto & itMv2 : mv2.mvData)  // all per-grade component of mv2
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)    // all per-grade component of mv1
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2)  // all per-grade component of mv2
             {
-                unsigned int grade_mv3 = itMv1.grade + (algebraDimension-itMv2.grade);
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+                unsigned int grade_mv3 = grade1 + (algebraDimension-grade2);
                 if(grade_mv3 <= algebraDimension) {
                     // handle the scalar product as well as the left contraction
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade_mv3);
-                    outerProductDualPrimal(itMv1.vec, itMv2.vec, itMv3->vec,
-                                           itMv1.grade, itMv2.grade, (unsigned)(algebraDimension-grade_mv3));
+                    outerProductDualPrimal<T>(kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(grade_mv3),
+                                              grade1, grade2, (unsigned)(algebraDimension-grade_mv3));
 
                     // check if the result is non-zero
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<grade_mv3);
-                    }
+                    mv3.removeGradeIfZero(grade_mv3);
                 }
             }
 
@@ -1171,21 +1157,19 @@ namespace c3ga{
     Mvec<T> Mvec<T>::outerDualDual(const Mvec<T> &mv2) const{
         Mvec<T> mv3;
 
-        for(const auto & itMv1 : this->mvData)    // all per-grade component of mv1
-            for(const auto & itMv2 : mv2.mvData)  // all per-grade component of mv2
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)    // all per-grade component of mv1
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2)  // all per-grade component of mv2
             {
-                unsigned int grade_mv3 = itMv1.grade + (algebraDimension-itMv2.grade);
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+                unsigned int grade_mv3 = grade1 + (algebraDimension-grade2);
                 if(grade_mv3 <= algebraDimension) {
                     // handle the scalar product as well as the left contraction
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(grade_mv3);
-                    outerProductDualDual(itMv1.vec, itMv2.vec, itMv3->vec,
-                                           itMv1.grade, itMv2.grade, (unsigned)(algebraDimension-grade_mv3));
+                    outerProductDualDual<T>(kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(grade_mv3),
+                                            grade1, grade2, (unsigned)(algebraDimension-grade_mv3));
 
                     // check if the result is non-zero
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<grade_mv3);
-                    }
+                    mv3.removeGradeIfZero(grade_mv3);
                 }
             }
 
@@ -1199,21 +1183,19 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::dotProduct(const Mvec<T> &mv2) const{
         // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled inner function using the functions pointer called innerFunctionsContainer
+        // call the right explicit unrolled inner function selected by innerExplicitDispatch
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
 
                 // perform the inner product
-                int absGradeMv3 = std::abs((int)(itMv1.grade - itMv2.grade));
-                auto itMv3 = mv3.createVectorXdIfDoesNotExist(absGradeMv3);
-                innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                int absGradeMv3 = std::abs((int)(grade1 - grade2));
+                innerExplicitDispatch<T>(grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(absGradeMv3));
 
                 // check if the result is non-zero
-                if(!((itMv3->vec.array() != 0.0).any())){
-                    mv3.mvData.erase(itMv3);
-                    mv3.gradeBitmap &= ~(1<<absGradeMv3);
-                }
+                mv3.removeGradeIfZero(absGradeMv3);
             }
         return mv3;
     }
@@ -1221,52 +1203,115 @@ namespace c3ga{
 
     template<typename T>
     Mvec<T> Mvec<T>::operator*(const Mvec<T> &mv2) const {
-        // Loop over non-empty grade of mv1 and mv2
-        // call the right explicit unrolled product function using the functions pointer
         Mvec<T> mv3;
-        for(const auto & itMv1 : this->mvData)
-            for(const auto & itMv2 : mv2.mvData){
-                
+        c3ga::geometric(mv3, *this, mv2);
+        return mv3;
+    }
+
+
+    template<typename T>
+    void geometric(Mvec<T> &mv3, const Mvec<T> &mv1, const Mvec<T> &mv2){
+        // the operands are read during the whole product
+        if(&mv3 == &mv1 || &mv3 == &mv2){
+            Mvec<T> result;
+            geometric(result, mv1, mv2);
+            mv3 = result;
+            return;
+        }
+
+        // Loop over non-empty grade of mv1 and mv2
+        // call the right explicit unrolled product functions selected by outerExplicitDispatch, innerExplicitDispatch and geometricExplicitDispatch
+        mv3.clear();
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(mv1.gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+
                 // outer product block
-                unsigned int gradeOuter = itMv1.grade + itMv2.grade;
+                unsigned int gradeOuter = grade1 + grade2;
                 if(gradeOuter <=  algebraDimension ){
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeOuter);
-                    outerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<gradeOuter);
-                    }
+                    outerExplicitDispatch<T>(grade1, grade2, mv1.kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(gradeOuter));
+                    mv3.removeGradeIfZero(gradeOuter);
                 }
 
                 // inner product block
-                unsigned int gradeInner = (unsigned int)std::abs((int)(itMv1.grade-itMv2.grade));
+                unsigned int gradeInner = (unsigned int)std::abs((int)(grade1-grade2));
                 // when the grade of one of the kvectors is zero, the inner product is the same as the outer product
                 if(gradeInner != gradeOuter) {
-                    auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeInner);
-                    innerFunctionsContainer<T>[itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                    innerExplicitDispatch<T>(grade1, grade2, mv1.kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(gradeInner));
                     // check if the result is non-zero
-                    if(!((itMv3->vec.array() != 0.0).any())){
-                        mv3.mvData.erase(itMv3);
-                        mv3.gradeBitmap &= ~(1<<gradeInner);
-                    }
+                    mv3.removeGradeIfZero(gradeInner);
 
                     // geometric product part
                     int gradeMax = std::min(((2*algebraDimension)-gradeOuter)+1,gradeOuter);
                     for (int gradeResult = gradeInner+2; gradeResult < gradeMax; gradeResult+=2) {
-                        auto itMv3 = mv3.createVectorXdIfDoesNotExist(gradeResult);
-                        geometricFunctionsContainer<T>[gradeResult][itMv1.grade][itMv2.grade](itMv1.vec, itMv2.vec, itMv3->vec);
+                        geometricExplicitDispatch<T>(gradeResult, grade1, grade2, mv1.kvec(grade1), mv2.kvec(grade2), mv3.createVectorXdIfDoesNotExist(gradeResult));
                         // check if the result is non-zero
-                        if(!((itMv3->vec.array() != 0.0).any())){
-                            mv3.mvData.erase(itMv3);
-                            mv3.gradeBitmap &= ~(1<<gradeResult);
-                        }
+                        mv3.removeGradeIfZero(gradeResult);
                     }
                 }
             }
+    }
+
+
+    template<typename T>
+    void Mvec<T>::productGradeAccumulate(const unsigned int grade, const Mvec<T> &mv2, KvecRef<T> mv3) const {
+        // same blocks and same order as operator*, restricted to the pairs of grades having a part of grade "grade"
+        for(unsigned int grade1=0; grade1<=algebraDimension; ++grade1)
+            for(unsigned int grade2=0; grade2<=algebraDimension; ++grade2){
+                if(!(gradeBitmap & (1<<grade1)) || !(mv2.gradeBitmap & (1<<grade2)))
+                    continue;
+
+                unsigned int gradeOuter = grade1 + grade2;
+                unsigned int gradeInner = (unsigned int)std::abs((int)(grade1-grade2));
+                if(grade < gradeInner || grade > gradeOuter || (grade - gradeInner) % 2 != 0 || grade > (2*algebraDimension)-gradeOuter)
+                    continue;
+
+                if(grade == gradeOuter)
+                    outerExplicitDispatch<T>(grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3);
+                else if(grade == gradeInner)
+                    innerExplicitDispatch<T>(grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3);
+                else
+                    geometricExplicitDispatch<T>(grade, grade1, grade2, kvec(grade1), mv2.kvec(grade2), mv3);
+            }
+    }
+
+
+    template<typename T>
+    Mvec<T> Mvec<T>::productGrade(const unsigned int grade, const Mvec<T> &mv2) const {
+        Mvec<T> mv3;
+        if(grade > algebraDimension)
+            return mv3;
+
+        productGradeAccumulate(grade, mv2, mv3.createVectorXdIfDoesNotExist(grade));
+
+        // check if the result is non-zero
+        mv3.removeGradeIfZero(grade);
         return mv3;
     }
 
 
+    template<typename T>
+    T Mvec<T>::productScalar(const Mvec<T> &mv2) const {
+        T scalar = T(0);
+        productGradeAccumulate(0, mv2, KvecRef<T>(&scalar, 1));
+        return scalar;
+    }
+
+
+    /// \brief compute only the part of grade GradeMv3 of the geometric product between two multivectors,
+    /// the other grades of the product are neither computed nor stored
+    /// \tparam GradeMv3 - the computed grade
+    /// \param mv1 - a multivector
+    /// \param mv2 - a multivector
+    /// \return (mv1*mv2).grade(GradeMv3), with the same values
+    template<unsigned int GradeMv3, typename T>
+    inline Mvec<T> productGrade(const Mvec<T> &mv1, const Mvec<T> &mv2){
+        static_assert(GradeMv3 <= algebraDimension, "the grade of the product exceeds the dimension of the algebra");
+        return mv1.productGrade(GradeMv3, mv2);
+    }
+
+
     template<typename U, typename S>
     Mvec<U> operator*(const S &value, const Mvec<U> &mv){
         return mv * value;
@@ -1277,15 +1322,16 @@ namespace c3ga{
     template<typename S>
     Mvec<T> Mvec<T>::operator*(const S &value) const{
         Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
-            itMv.vec *= T(value);
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv.gradeBitmap & (1<<grade))
+                mv.kvec(grade) *= T(value);
         return mv;
     }
 
 
     template<typename T>
     Mvec<T> &Mvec<T>::operator*=(const Mvec &mv) {
-        *this = *this * mv;
+        c3ga::geometric(*this, *this, mv);
         return *this;
     }
 
@@ -1306,8 +1352,9 @@ namespace c3ga{
     template<typename S>
     Mvec<T> Mvec<T>::operator/(const S &value) const {
         Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
-            itMv.vec /= value;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(mv.gradeBitmap & (1<<grade))
+                mv.kvec(grade) /= value;
         return mv;
     }
 
@@ -1389,24 +1436,38 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::dual() const {
         Mvec<T> mvResult;
+        c3ga::dual(mvResult, *this);
+        return mvResult;
+    }
+
+
+    template<typename T>
+    void dual(Mvec<T> &dualMv, const Mvec<T> &mv){
+        // the multivector is read during the whole computation
+        if(&dualMv == &mv){
+            Mvec<T> result;
+            dual(result, mv);
+            dualMv = result;
+            return;
+        }
+
+        dualMv.clear();
         // for each k-vectors of the multivector
-        for(auto itMv=mvData.rbegin(); itMv!=mvData.rend(); ++itMv){
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+            if(!(mv.gradeBitmap & (1<<grade)))
+                continue;
 
             // create the dual k-vector
-            Kvec<T> kvec ={itMv->vec,algebraDimension-(itMv->grade)};
+            KvecRef<T> dualKvec = dualMv.createVectorXdIfDoesNotExist(algebraDimension-grade);
+            ConstKvecRef<T> primalKvec = mv.kvec(grade);
 
             // some elements need to be permuted
-            for(unsigned int i=0;i<binomialArray[itMv->grade];++i)
-                kvec.vec.coeffRef(dualPermutations[itMv->grade][i]) = itMv->vec.coeff(i);
+            for(unsigned int i=0;i<binomialArray[grade];++i)
+                dualKvec.coeffRef(dualPermutations[grade][i]) = primalKvec.coeff(i);
 
             // the inner product may involve some constant multiplucation for the dual elements
-            kvec.vec = kvec.vec.cwiseProduct(dualCoefficients[itMv->grade].template cast<T>());
-
-            // add the k-vector to the resulting multivector
-            mvResult.mvData.push_back(kvec);
-            mvResult.gradeBitmap |= (1 << kvec.grade);
+            dualKvec = dualKvec.cwiseProduct(dualCoefficients[grade].template cast<T>());
         }
-        return mvResult;
     }
 
     // \brief compute the reverse of a multivector
@@ -1414,9 +1475,9 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::reverse() const {
         Mvec<T> mv(*this);
-        for(auto & itMv : mv.mvData)
-            if(signReversePerGrade[itMv.grade] == -1)
-                itMv.vec *= -1;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if((mv.gradeBitmap & (1<<grade)) && signReversePerGrade[grade] == -1)
+                mv.kvec(grade) *= -1;
         return mv;
     }
 
@@ -1424,15 +1485,14 @@ namespace c3ga{
     template<typename T>
     Mvec<T> Mvec<T>::grade(const int i) const{
 
-        auto it = findGrade(i);
         Mvec<T> mv;
 
         // if not found, return the empty multivector
-        if(it == mvData.end())
+        if((gradeBitmap & (1<<i)) == 0)
             return mv;
 
         // else return the grade 'i' data
-        mv.mvData.push_back(*it);
+        mv.kvec(i) = kvec(i);
         mv.gradeBitmap = 1 << (i);
 
         return mv;
@@ -1455,18 +1515,16 @@ namespace c3ga{
     template<typename T>
     void Mvec<T>::roundZero(const T epsilon) {
         // loop over each k-vector of the multivector
-        auto itMv=mvData.begin();
-        while(itMv != mvData.end()){
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+            if(!(gradeBitmap & (1<<grade)))
+                continue;
             // loop over each element of the k-vector
-            for(unsigned int i=0; i<(unsigned int)itMv->vec.size(); ++i)
-                if(fabs(itMv->vec.coeff(i)) <= epsilon)
-                    itMv->vec.coeffRef(i) = 0.0;
+            KvecRef<T> coefficients = kvec(grade);
+            for(unsigned int i=0; i<(unsigned int)coefficients.size(); ++i)
+                if(fabs(coefficients.coeff(i)) <= epsilon)
+                    coefficients.coeffRef(i) = 0.0;
             // if the k-vector is full of 0, remove it
-            if(!((itMv->vec.array() != 0.0).any())){
-                gradeBitmap = gradeBitmap - (1 << itMv->grade);
-                mvData.erase(itMv++);
-            }
-            else ++itMv;
+            removeGradeIfZero(grade);
         }
     }
 
@@ -1476,28 +1534,29 @@ namespace c3ga{
 
         // full erase
         if(grade < 0){
-            mvData.clear();
+            mvData.fill(T(0));
             gradeBitmap = 0;
             return;
         }
 
         // partial erase
-        auto iter = findGrade(grade);
-        if(iter != mvData.end()) {
-            gradeBitmap = gradeBitmap - (1 << iter->grade);
-            iter = mvData.erase(iter);
+        if(gradeBitmap & (1<<grade)) {
+            gradeBitmap = gradeBitmap - (1 << grade);
+            kvec(grade).setZero();
         }
     }
 
 
     template<typename T>
     void Mvec<T>::display() const {
-        if(mvData.size() == 0)
+        if(gradeBitmap == 0)
             std::cout << " null grade , null value " <<std::endl;
 
-        for(auto itmv=mvData.begin(); itmv!=mvData.end(); ++itmv){
-            std::cout << "  grade   : " << itmv->grade  << std::endl;
-            std::cout << "  kvector : " << itmv->vec.transpose() << std::endl;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+            if(!(gradeBitmap & (1<<grade)))
+                continue;
+            std::cout << "  grade   : " << grade  << std::endl;
+            std::cout << "  kvector : " << kvec(grade).transpose() << std::endl;
         }
         std::cout << std::endl;
     }
@@ -1505,7 +1564,7 @@ namespace c3ga{
 
     /// \cond DEV
     template<typename U>
-    void traverseKVector(std::ostream &stream, const Eigen::Matrix<U, Eigen::Dynamic, 1> kvector, unsigned int gradeMV, bool& moreThanOne ){
+    void traverseKVector(std::ostream &stream, const ConstKvecRef<U> kvector, unsigned int gradeMV, bool& moreThanOne ){
 
         // version with XOR indices
         // for the current grade, generate all the XOR indices
@@ -1546,26 +1605,26 @@ namespace c3ga{
 
     template<typename U>
     std::ostream &operator<<(std::ostream &stream, const Mvec<U> &mvec) {
-        if(mvec.mvData.size()==0){
+        if(mvec.gradeBitmap == 0){
             stream << " 0 ";
             return stream;
         }
 
         bool moreThanOne = false;
-        auto mvIterator = mvec.mvData.begin();
 
-        // if the iterator corresponds to the scalar
-        if(mvIterator->grade == 0){
-            stream << mvIterator->vec.coeff(0);
+        // if the multivector contains a scalar
+        if(mvec.gradeBitmap & 1){
+            stream << mvec.mvData[0];
             moreThanOne = true;
-            ++mvIterator;
         }
 
         // for all other k-vectors of mvec
-        for(; mvIterator!=mvec.mvData.end(); ++mvIterator){
+        for(unsigned int grade=1; grade<=algebraDimension; ++grade){
+            if(!(mvec.gradeBitmap & (1<<grade)))
+                continue;
 
             // call the function that covers a single k-vector
-            traverseKVector(stream,mvIterator->vec,mvIterator->grade, moreThanOne);
+            traverseKVector(stream,mvec.kvec(grade),grade, moreThanOne);
         }
 
         if(!moreThanOne)
@@ -0,0 +1,268 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Orthogonal.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Orthogonal.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Multivectors stored in the orthogonal basis (e+, e1, e2, e3, e-) of c3ga, where the metric is diagonal.
+/// With e0 = (e- - e+)/2 and ei = e+ + e-, the square of every basis vector is 1 (e+, e1, e2, e3) or -1 (e-), so the
+/// geometric product of two basis blades is a single basis blade (the xor of their indices) with a sign. The signs of
+/// the 32x32 products are computed at compile time (orthogonalCayleyTable), as the matrices of the change of basis,
+/// which is only done at the boundary: OrthogonalMvec(mv) and toMvec(). A long chain of products of multivectors of
+/// any grades (e.g. versors) can then be computed in this basis, for instance:
+/// \code
+///     c3ga::OrthogonalMvec<double> motor = c3ga::OrthogonalMvec<double>(translator) * c3ga::OrthogonalMvec<double>(rotor);
+///     c3ga::Mvec<double> sphere = (motor * c3ga::OrthogonalMvec<double>(dualSphere) * motor.reverse()).toMvec();
+/// \endcode
+/// The results are the ones of Mvec, up to the rounding errors (the coefficients are not computed in the same order).
+/// This representation is opt-in: Mvec and the functions built on it (whoAmI, surfaceNormal, ...) do not use it.
+
+
+// Anti-doublon
+#ifndef C3GA_ORTHOGONAL_HPP__
+#define C3GA_ORTHOGONAL_HPP__
+#pragma once
+
+// External Includes
+#include <array>
+#include <utility>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    /// \cond DEV
+    /// \brief number of basis vectors of a blade
+    constexpr unsigned int bladeGrade(unsigned int xorIndex){
+        unsigned int grade = 0;
+        for(; xorIndex != 0; xorIndex >>= 1)
+            grade += xorIndex & 1;
+        return grade;
+    }
+
+    /// \brief sign of the permutation sorting the basis vectors of the blade a followed by the ones of the blade b (xor indices)
+    constexpr int canonicalReorderingSign(unsigned int a, const unsigned int b){
+        unsigned int swaps = 0;
+        for(a >>= 1; a != 0; a >>= 1)
+            swaps += bladeGrade(a & b);
+        return (swaps & 1) ? -1 : 1;
+    }
+
+    /// \brief signs of the products of the basis blades in the orthogonal basis
+    struct OrthogonalCayleyTable {
+        signed char sign[nbCoefficients][nbCoefficients];
+    };
+
+    /// \brief change of basis of the blades, coefficient[blade of the new basis][blade of the old basis]
+    struct BladeBasisChange {
+        double coefficient[nbCoefficients][nbCoefficients];
+    };
+    /// \endcond
+
+    constexpr int orthogonalMetric[5] = {1, 1, 1, 1, -1}; /*!< squares of the orthogonal basis vectors e+, e1, e2, e3, e- */
+
+    constexpr double originalToOrthogonalVectors[5][5] = {{-0.5, 0, 0, 0, 0.5}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {1, 0, 0, 0, 1}}; /*!< e0, e1, e2, e3, ei in the orthogonal basis */
+
+    constexpr double orthogonalToOriginalVectors[5][5] = {{-1, 0, 0, 0, 0.5}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {1, 0, 0, 0, 0.5}}; /*!< e+, e1, e2, e3, e- in the original basis */
+
+    /// \cond DEV
+    /// \brief compute the signs of the products of the basis blades of the orthogonal basis (the metric is diagonal)
+    constexpr OrthogonalCayleyTable computeOrthogonalCayleyTable(){
+        OrthogonalCayleyTable table{};
+        for(unsigned int a=0; a<nbCoefficients; ++a)
+            for(unsigned int b=0; b<nbCoefficients; ++b){
+                int sign = canonicalReorderingSign(a, b);
+                for(unsigned int vector=0; vector<algebraDimension; ++vector)
+                    if((a & b) & (1 << vector))
+                        sign *= orthogonalMetric[vector];
+                table.sign[a][b] = (signed char)sign;
+            }
+        return table;
+    }
+
+    /// \brief compute the change of basis of the blades (outermorphism) from the change of basis of the vectors
+    /// \param vectors - vectors[i][j] is the coefficient of the new basis vector j in the old basis vector i
+    constexpr BladeBasisChange computeBladeBasisChange(const double (&vectors)[5][5]){
+        BladeBasisChange change{};
+        for(unsigned int blade=0; blade<nbCoefficients; ++blade){
+            // wedge the new expressions of the basis vectors of the blade, in increasing order
+            double current[nbCoefficients] = {1};
+            for(unsigned int vector=0; vector<algebraDimension; ++vector){
+                if(!(blade & (1 << vector)))
+                    continue;
+                double next[nbCoefficients] = {};
+                for(unsigned int partial=0; partial<nbCoefficients; ++partial)
+                    for(unsigned int newVector=0; newVector<algebraDimension; ++newVector)
+                        if(current[partial] != 0 && vectors[vector][newVector] != 0 && !(partial & (1 << newVector)))
+                            next[partial | (1 << newVector)] += canonicalReorderingSign(partial, 1 << newVector) * current[partial] * vectors[vector][newVector];
+                for(unsigned int i=0; i<nbCoefficients; ++i)
+                    current[i] = next[i];
+            }
+            for(unsigned int newBlade=0; newBlade<nbCoefficients; ++newBlade)
+                change.coefficient[newBlade][blade] = current[newBlade];
+        }
+        return change;
+    }
+    /// \endcond
+
+    constexpr OrthogonalCayleyTable orthogonalCayleyTable = computeOrthogonalCayleyTable(); /*!< e_a * e_b = orthogonalCayleyTable.sign[a][b] * e_(a xor b) in the orthogonal basis */
+
+    constexpr BladeBasisChange originalToOrthogonal = computeBladeBasisChange(originalToOrthogonalVectors); /*!< blades of the original basis in the orthogonal basis */
+
+    constexpr BladeBasisChange orthogonalToOriginal = computeBladeBasisChange(orthogonalToOriginalVectors); /*!< blades of the orthogonal basis in the original basis */
+
+
+    /// \cond DEV
+    /// \brief coefficient of the blade NewBlade after a change of basis, unrolled with the coefficients known at compile time
+    /// (-0.0 is the neutral element of the addition, the terms with a zero coefficient are removed by the compiler)
+    template<typename T, const BladeBasisChange &Change, unsigned int NewBlade, typename Source, unsigned int... Blade>
+    inline T changeOfBasisBlade(const Source &source, std::integer_sequence<unsigned int, Blade...>){
+        return (T(-0.0) + ... + (Change.coefficient[NewBlade][Blade] != 0 ? T(Change.coefficient[NewBlade][Blade]) * source[Blade] : T(-0.0)));
+    }
+
+    /// \brief coefficients of all the blades after a change of basis
+    template<typename T, const BladeBasisChange &Change, typename Source, unsigned int... Blade>
+    inline std::array<T, nbCoefficients> changeOfBasis(const Source &source, std::integer_sequence<unsigned int, Blade...> blades){
+        return {{changeOfBasisBlade<T, Change, Blade>(source, blades)...}};
+    }
+    /// \endcond
+
+
+    /// \class OrthogonalMvec
+    /// \brief multivector stored in the orthogonal basis (e+, e1, e2, e3, e-), the coefficients are indexed by xor index
+    /// \tparam T - type of the coefficients
+    template<typename T = double>
+    class OrthogonalMvec {
+
+    protected:
+        std::array<T, nbCoefficients> coefficients; /*!< coefficient of each blade of the orthogonal basis, by xor index */
+
+        /// \brief coefficient of the blade Blade of the product of this multivector and mv2, sum of the products of the
+        /// basis blades e_a * e_(a xor Blade) kept by Keep, unrolled with the signs known at compile time (see changeOfBasisBlade)
+        template<typename Keep, unsigned int Blade, unsigned int... A>
+        inline T productBlade(const OrthogonalMvec &mv2, std::integer_sequence<unsigned int, A...>) const {
+            return (T(-0.0) + ... + (Keep::keep(A, A ^ Blade) ? T(orthogonalCayleyTable.sign[A][A ^ Blade]) * coefficients[A] * mv2.coefficients[A ^ Blade] : T(-0.0)));
+        }
+
+        /// \brief product of this multivector and mv2, only the products of basis blades kept by Keep::keep(a, b)
+        template<typename Keep, unsigned int... Blade>
+        inline OrthogonalMvec product(const OrthogonalMvec &mv2, std::integer_sequence<unsigned int, Blade...> blades) const {
+            OrthogonalMvec mv3;
+            ((mv3.coefficients[Blade] = productBlade<Keep, Blade>(mv2, blades)), ...);
+            return mv3;
+        }
+
+        /// \cond DEV
+        struct KeepGeometric {
+            static constexpr bool keep(unsigned int, unsigned int){ return true; }
+        };
+        struct KeepOuter {
+            static constexpr bool keep(unsigned int a, unsigned int b){ return (a & b) == 0; }
+        };
+        struct KeepInner {
+            static constexpr bool keep(unsigned int a, unsigned int b){
+                return xorIndexToGrade[a] != 0 && xorIndexToGrade[b] != 0
+                       && xorIndexToGrade[a ^ b] == (xorIndexToGrade[a] > xorIndexToGrade[b] ? xorIndexToGrade[a] - xorIndexToGrade[b] : xorIndexToGrade[b] - xorIndexToGrade[a]);
+            }
+        };
+        /// \endcond
+
+    public:
+
+        /// \brief the multivector 0
+        OrthogonalMvec() : coefficients() {}
+
+        /// \brief change of basis of a multivector of the original basis (e0, e1, e2, e3, ei)
+        /// \param mv - the multivector
+        explicit OrthogonalMvec(const Mvec<T> &mv)
+            : coefficients(changeOfBasis<T, originalToOrthogonal>(mv, std::make_integer_sequence<unsigned int, nbCoefficients>())) {}
+
+        /// \brief change of basis to the original basis (e0, e1, e2, e3, ei)
+        /// \return the multivector in the original basis, without the grades whose coefficients are all zero
+        Mvec<T> toMvec() const {
+            const std::array<T, nbCoefficients> original = changeOfBasis<T, orthogonalToOriginal>(*this, std::make_integer_sequence<unsigned int, nbCoefficients>());
+            Mvec<T> mv;
+            for(unsigned int blade=0; blade<nbCoefficients; ++blade)
+                if(original[blade] != T(0)) // a grade is only added with a non-zero coefficient
+                    mv[blade] = original[blade];
+            return mv;
+        }
+
+        /// \brief coefficient of a blade of the orthogonal basis
+        /// \param xorIndex - xor index of the blade (bit 0 for e+, bits 1 to 3 for e1 to e3, bit 4 for e-)
+        inline T& operator[](const unsigned int xorIndex){
+            return coefficients[xorIndex];
+        }
+
+        /// \brief coefficient of a blade of the orthogonal basis
+        /// \param xorIndex - xor index of the blade (bit 0 for e+, bits 1 to 3 for e1 to e3, bit 4 for e-)
+        inline const T& operator[](const unsigned int xorIndex) const{
+            return coefficients[xorIndex];
+        }
+
+        /// \brief the scalar part, the same in both bases
+        inline T scalar() const {
+            return coefficients[0];
+        }
+
+        /// \brief sum of two multivectors
+        OrthogonalMvec operator+(const OrthogonalMvec &mv2) const {
+            OrthogonalMvec mv3(*this);
+            for(unsigned int blade=0; blade<nbCoefficients; ++blade)
+                mv3.coefficients[blade] += mv2.coefficients[blade];
+            return mv3;
+        }
+
+        /// \brief difference of two multivectors
+        OrthogonalMvec operator-(const OrthogonalMvec &mv2) const {
+            OrthogonalMvec mv3(*this);
+            for(unsigned int blade=0; blade<nbCoefficients; ++blade)
+                mv3.coefficients[blade] -= mv2.coefficients[blade];
+            return mv3;
+        }
+
+        /// \brief product with a scalar
+        OrthogonalMvec operator*(const T &value) const {
+            OrthogonalMvec mv(*this);
+            for(unsigned int blade=0; blade<nbCoefficients; ++blade)
+                mv.coefficients[blade] *= value;
+            return mv;
+        }
+
+        /// \brief geometric product, with the signs of orthogonalCayleyTable
+        OrthogonalMvec operator*(const OrthogonalMvec &mv2) const {
+            return product<KeepGeometric>(mv2, std::make_integer_sequence<unsigned int, nbCoefficients>());
+        }
+
+        /// \brief outer product, the products of blades without common basis vector
+        OrthogonalMvec operator^(const OrthogonalMvec &mv2) const {
+            return product<KeepOuter>(mv2, std::make_integer_sequence<unsigned int, nbCoefficients>());
+        }
+
+        /// \brief inner product, same definition as Mvec::operator| (part of grade |grade1 - grade2|, 0 with a scalar)
+        OrthogonalMvec operator|(const OrthogonalMvec &mv2) const {
+            return product<KeepInner>(mv2, std::make_integer_sequence<unsigned int, nbCoefficients>());
+        }
+
+        /// \brief reverse, the same signs per grade as in the original basis
+        OrthogonalMvec reverse() const {
+            OrthogonalMvec mv(*this);
+            for(unsigned int blade=0; blade<nbCoefficients; ++blade)
+                if(signReversePerGrade[xorIndexToGrade[blade]] == -1)
+                    mv.coefficients[blade] = -mv.coefficients[blade];
+            return mv;
+        }
+    };
+
+}/// End of Namespace
+
+#endif // C3GA_ORTHOGONAL_HPP__
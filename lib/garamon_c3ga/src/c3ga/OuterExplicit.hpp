@@ -30,88 +30,118 @@ namespace c3ga {
 
     /// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 0
-	template<typename T>
-	void outer_0_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void outer_0_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void outer_0_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
+		mv3.coeffRef(5) += mv1.coeff(0)*mv2.coeff(5);
+		mv3.coeffRef(6) += mv1.coeff(0)*mv2.coeff(6);
+		mv3.coeffRef(7) += mv1.coeff(0)*mv2.coeff(7);
+		mv3.coeffRef(8) += mv1.coeff(0)*mv2.coeff(8);
+		mv3.coeffRef(9) += mv1.coeff(0)*mv2.coeff(9);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void outer_0_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
+		mv3.coeffRef(5) += mv1.coeff(0)*mv2.coeff(5);
+		mv3.coeffRef(6) += mv1.coeff(0)*mv2.coeff(6);
+		mv3.coeffRef(7) += mv1.coeff(0)*mv2.coeff(7);
+		mv3.coeffRef(8) += mv1.coeff(0)*mv2.coeff(8);
+		mv3.coeffRef(9) += mv1.coeff(0)*mv2.coeff(9);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void outer_0_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(0)*mv2.coeff(1);
+		mv3.coeffRef(2) += mv1.coeff(0)*mv2.coeff(2);
+		mv3.coeffRef(3) += mv1.coeff(0)*mv2.coeff(3);
+		mv3.coeffRef(4) += mv1.coeff(0)*mv2.coeff(4);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 0) and mv2 (grade 5). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 0 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 5 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_0_5(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1.coeff(0)*mv2;
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_0_5(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 1
-	template<typename T>
-	void outer_1_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_1_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void outer_1_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_1_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(1) - mv1.coeff(1)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(3)*mv2.coeff(0);
@@ -127,11 +157,11 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void outer_1_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_1_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(2)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(5) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(6) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(4)*mv2.coeff(0);
@@ -147,11 +177,11 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void outer_1_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_1_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(6) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(2)*mv2.coeff(1) - mv1.coeff(3)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(7) - mv1.coeff(1)*mv2.coeff(4) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(8) - mv1.coeff(1)*mv2.coeff(5) + mv1.coeff(3)*mv2.coeff(2) - mv1.coeff(4)*mv2.coeff(1);
@@ -162,33 +192,42 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 1) and mv2 (grade 4). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 1 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 4 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_1_4(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_1_4(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 2
-	template<typename T>
-	void outer_2_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_2_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
+		mv3.coeffRef(5) += mv1.coeff(5)*mv2.coeff(0);
+		mv3.coeffRef(6) += mv1.coeff(6)*mv2.coeff(0);
+		mv3.coeffRef(7) += mv1.coeff(7)*mv2.coeff(0);
+		mv3.coeffRef(8) += mv1.coeff(8)*mv2.coeff(0);
+		mv3.coeffRef(9) += mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void outer_2_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_2_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(2) - mv1.coeff(1)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(2)*mv2.coeff(1) + mv1.coeff(5)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(6)*mv2.coeff(0);
@@ -204,11 +243,11 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void outer_2_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_2_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(7) - mv1.coeff(1)*mv2.coeff(5) + mv1.coeff(2)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(2) - mv1.coeff(5)*mv2.coeff(1) + mv1.coeff(7)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(8) - mv1.coeff(1)*mv2.coeff(6) + mv1.coeff(3)*mv2.coeff(4) + mv1.coeff(4)*mv2.coeff(3) - mv1.coeff(6)*mv2.coeff(1) + mv1.coeff(8)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(2)*mv2.coeff(6) + mv1.coeff(3)*mv2.coeff(5) + mv1.coeff(5)*mv2.coeff(3) - mv1.coeff(6)*mv2.coeff(2) + mv1.coeff(9)*mv2.coeff(0);
@@ -219,33 +258,42 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 2) and mv2 (grade 3). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 2 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 3 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_2_3(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_2_3(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(1)*mv2.coeff(8) + mv1.coeff(2)*mv2.coeff(7) - mv1.coeff(3)*mv2.coeff(6) + mv1.coeff(4)*mv2.coeff(5) - mv1.coeff(5)*mv2.coeff(4) + mv1.coeff(6)*mv2.coeff(3) + mv1.coeff(7)*mv2.coeff(2) - mv1.coeff(8)*mv2.coeff(1) + mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 3
-	template<typename T>
-	void outer_3_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_3_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
+		mv3.coeffRef(5) += mv1.coeff(5)*mv2.coeff(0);
+		mv3.coeffRef(6) += mv1.coeff(6)*mv2.coeff(0);
+		mv3.coeffRef(7) += mv1.coeff(7)*mv2.coeff(0);
+		mv3.coeffRef(8) += mv1.coeff(8)*mv2.coeff(0);
+		mv3.coeffRef(9) += mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void outer_3_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_3_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(3) - mv1.coeff(1)*mv2.coeff(2) + mv1.coeff(3)*mv2.coeff(1) - mv1.coeff(6)*mv2.coeff(0);
 		mv3.coeffRef(1) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(2) + mv1.coeff(4)*mv2.coeff(1) - mv1.coeff(7)*mv2.coeff(0);
 		mv3.coeffRef(2) +=  mv1.coeff(1)*mv2.coeff(4) - mv1.coeff(2)*mv2.coeff(3) + mv1.coeff(5)*mv2.coeff(1) - mv1.coeff(8)*mv2.coeff(0);
@@ -256,52 +304,56 @@ namespace c3ga {
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 3) and mv2 (grade 2). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 3 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 2 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 3 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 2 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_3_2(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_3_2(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(9) - mv1.coeff(1)*mv2.coeff(8) + mv1.coeff(2)*mv2.coeff(7) + mv1.coeff(3)*mv2.coeff(6) - mv1.coeff(4)*mv2.coeff(5) + mv1.coeff(5)*mv2.coeff(4) - mv1.coeff(6)*mv2.coeff(3) + mv1.coeff(7)*mv2.coeff(2) - mv1.coeff(8)*mv2.coeff(1) + mv1.coeff(9)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 4
-	template<typename T>
-	void outer_4_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_4_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
+		mv3.coeffRef(1) += mv1.coeff(1)*mv2.coeff(0);
+		mv3.coeffRef(2) += mv1.coeff(2)*mv2.coeff(0);
+		mv3.coeffRef(3) += mv1.coeff(3)*mv2.coeff(0);
+		mv3.coeffRef(4) += mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 4) and mv2 (grade 1). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 4 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 1 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 4 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 1 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_4_1(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_4_1(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
 		mv3.coeffRef(0) +=  mv1.coeff(0)*mv2.coeff(4) - mv1.coeff(1)*mv2.coeff(3) + mv1.coeff(2)*mv2.coeff(2) - mv1.coeff(3)*mv2.coeff(1) + mv1.coeff(4)*mv2.coeff(0);
 	}
 
 
 	/// \brief Compute the outer product between two homogeneous multivectors mv1 (grade 5) and mv2 (grade 0). 
 	/// \tparam the type of value that we manipulate, either float or double or something.
-	/// \param mv1 - the first homogeneous multivector of grade 5 represented as an Eigen::VectorXd
-	/// \param mv2 - the second homogeneous multivector of grade 0 represented as a Eigen::VectorXd
+	/// \param mv1 - the first homogeneous multivector of grade 5 given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector of grade 0 given by its coefficients (KvecRef or KVector)
 	/// \param mv3 - the result of mv1^mv2, which is also a homogeneous multivector of grade 5
-	template<typename T>
-	void outer_5_0(const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv1, const Eigen::Matrix<T, Eigen::Dynamic, 1>& mv2, Eigen::Matrix<T, Eigen::Dynamic, 1>& mv3){
-		mv3 += mv1*mv2.coeff(0);
+	template<typename T, typename Mv1 = ConstKvecRef<T>, typename Mv2 = ConstKvecRef<T>, typename Mv3 = KvecRef<T>>
+	constexpr void outer_5_0(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		mv3.coeffRef(0) += mv1.coeff(0)*mv2.coeff(0);
 	}
 
 
 	
 
     template<typename T>
-	std::array<std::array<std::function<void(const Eigen::Matrix<T, Eigen::Dynamic, 1> & , const Eigen::Matrix<T, Eigen::Dynamic, 1> & , Eigen::Matrix<T, Eigen::Dynamic, 1>&)>, 6>, 6> outerFunctionsContainer = {{
+	std::array<std::array<std::function<void(ConstKvecRef<T>, ConstKvecRef<T>, KvecRef<T>)>, 6>, 6> outerFunctionsContainer = {{
 		{{outer_0_0<T>,outer_0_1<T>,outer_0_2<T>,outer_0_3<T>,outer_0_4<T>,outer_0_5<T>}},
 		{{outer_1_0<T>,outer_1_1<T>,outer_1_2<T>,outer_1_3<T>,outer_1_4<T>,{}}},
 		{{outer_2_0<T>,outer_2_1<T>,outer_2_2<T>,outer_2_3<T>,{},{}}},
@@ -310,6 +362,101 @@ namespace c3ga {
 		{{outer_5_0<T>,{},{},{},{},{}}}
 	}};
 
+    /// \brief Compute the outer product between two homogeneous multivectors mv1 and mv2 of grades given at runtime, with the explicit function of these grades.
+	/// The function is selected by a switch on the grades, so the compiler can inline the explicit functions in the products of Mvec.
+	/// Define C3GA_STD_FUNCTION_DISPATCH to call them through outerFunctionsContainer instead.
+	/// \param gradeMv1 - grade of mv1
+	/// \param gradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients
+	/// \param mv2 - the second homogeneous multivector given by its coefficients
+	/// \param mv3 - the result of mv1^mv2
+	template<typename T>
+	inline void outerExplicitDispatch(const unsigned int gradeMv1, const unsigned int gradeMv2, ConstKvecRef<T> mv1, ConstKvecRef<T> mv2, KvecRef<T> mv3){
+#ifdef C3GA_STD_FUNCTION_DISPATCH
+		outerFunctionsContainer<T>[gradeMv1][gradeMv2](mv1, mv2, mv3);
+#else
+		switch(gradeMv1*6 + gradeMv2){
+			case 0*6+0: outer_0_0<T>(mv1, mv2, mv3); break;
+			case 0*6+1: outer_0_1<T>(mv1, mv2, mv3); break;
+			case 0*6+2: outer_0_2<T>(mv1, mv2, mv3); break;
+			case 0*6+3: outer_0_3<T>(mv1, mv2, mv3); break;
+			case 0*6+4: outer_0_4<T>(mv1, mv2, mv3); break;
+			case 0*6+5: outer_0_5<T>(mv1, mv2, mv3); break;
+			case 1*6+0: outer_1_0<T>(mv1, mv2, mv3); break;
+			case 1*6+1: outer_1_1<T>(mv1, mv2, mv3); break;
+			case 1*6+2: outer_1_2<T>(mv1, mv2, mv3); break;
+			case 1*6+3: outer_1_3<T>(mv1, mv2, mv3); break;
+			case 1*6+4: outer_1_4<T>(mv1, mv2, mv3); break;
+			case 2*6+0: outer_2_0<T>(mv1, mv2, mv3); break;
+			case 2*6+1: outer_2_1<T>(mv1, mv2, mv3); break;
+			case 2*6+2: outer_2_2<T>(mv1, mv2, mv3); break;
+			case 2*6+3: outer_2_3<T>(mv1, mv2, mv3); break;
+			case 3*6+0: outer_3_0<T>(mv1, mv2, mv3); break;
+			case 3*6+1: outer_3_1<T>(mv1, mv2, mv3); break;
+			case 3*6+2: outer_3_2<T>(mv1, mv2, mv3); break;
+			case 4*6+0: outer_4_0<T>(mv1, mv2, mv3); break;
+			case 4*6+1: outer_4_1<T>(mv1, mv2, mv3); break;
+			case 5*6+0: outer_5_0<T>(mv1, mv2, mv3); break;
+			default: break;
+		}
+#endif
+	}
+
+    /// \brief Compute the outer product between two homogeneous multivectors mv1 (grade GradeMv1) and mv2 (grade GradeMv2), the explicit function is selected at compile time.
+	/// \tparam GradeMv1 - grade of mv1
+	/// \tparam GradeMv2 - grade of mv2
+	/// \param mv1 - the first homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv2 - the second homogeneous multivector given by its coefficients (KvecRef or KVector)
+	/// \param mv3 - the result of mv1^mv2, whose grade is GradeMv1 + GradeMv2
+	template<unsigned int GradeMv1, unsigned int GradeMv2, typename T, typename Mv1, typename Mv2, typename Mv3>
+	constexpr void outerExplicit(const Mv1& mv1, const Mv2& mv2, Mv3&& mv3){
+		static_assert(GradeMv1 + GradeMv2 <= algebraDimension, "the outer product of these grades is always zero");
+		if constexpr(GradeMv1 == 0 && GradeMv2 == 0)
+			outer_0_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 1)
+			outer_0_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 2)
+			outer_0_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 3)
+			outer_0_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 4)
+			outer_0_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 0 && GradeMv2 == 5)
+			outer_0_5<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 0)
+			outer_1_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 1)
+			outer_1_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 2)
+			outer_1_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 3)
+			outer_1_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 1 && GradeMv2 == 4)
+			outer_1_4<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 0)
+			outer_2_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 1)
+			outer_2_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 2)
+			outer_2_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 2 && GradeMv2 == 3)
+			outer_2_3<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 0)
+			outer_3_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 1)
+			outer_3_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 3 && GradeMv2 == 2)
+			outer_3_2<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 0)
+			outer_4_0<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 4 && GradeMv2 == 1)
+			outer_4_1<T>(mv1, mv2, mv3);
+		else if constexpr(GradeMv1 == 5 && GradeMv2 == 0)
+			outer_5_0<T>(mv1, mv2, mv3);
+		else
+			static_assert(GradeMv1 != GradeMv1, "no explicit function for these grades");
+	}
+
 }/// End of Namespace
 
 #endif // C3GA_OUTER_PRODUCT_EXPLICIT_HPP__
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Outermorphism.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Outermorphism.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Versors compiled into the matrices of their outermorphism, in the Geometric algebra of c3ga.
+/// The sandwich product V * X * ~V of a versor V (rotor, translator, motor, dilator, ...) is linear and keeps the
+/// grade of X: it is a square matrix per grade (1x1, 5x5, 10x10, 10x10, 5x5, 1x1). The matrices are computed
+/// once from V, then transforming an object is a product matrix-vector per grade instead of two geometric
+/// products, and c3ga::batch::transform transforms arrays of k-vectors (see Batch.hpp). For instance:
+/// \code
+///     c3ga::Outermorphism<double> motion(motor);
+///     for(auto &sphere : dualSpheres)
+///         motion.apply(sphere, sphere);
+/// \endcode
+/// The results are the ones of the sandwich product, up to the rounding errors (the sums are not in the same order).
+
+
+// Anti-doublon
+#ifndef C3GA_OUTERMORPHISM_HPP__
+#define C3GA_OUTERMORPHISM_HPP__
+#pragma once
+
+// External Includes
+#include <array>
+#include <cstddef>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+#include "c3ga/KVector.hpp"
+#include "c3ga/Batch.hpp"
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    constexpr unsigned int perGradeMatrixStartingIndex[6] = {0,1,26,126,226,251}; /*!< index of the first coefficient of the matrix of grade k in an outermorphism */
+
+    constexpr unsigned int nbOutermorphismCoefficients = 252; /*!< number of coefficients of the matrices of an outermorphism (sum of the squares of binomialArray) */
+
+    template<typename T>
+    using MatrixRef = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>; /*!< view on the matrix of grade k of an outermorphism */
+
+    template<typename T>
+    using ConstMatrixRef = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>; /*!< read-only view on the matrix of grade k of an outermorphism */
+
+
+    /// \class Outermorphism
+    /// \brief linear map X -> V * X * ~V of a versor V, stored as one matrix per grade
+    /// \tparam T - type of the coefficients
+    template<typename T = double>
+    class Outermorphism {
+
+    protected:
+        std::array<T, nbOutermorphismCoefficients> matrixData; /*!< matrices of the grades 0 to 5, column-major, one after another */
+
+    public:
+
+        /// \brief identity (the outermorphism of the versor 1)
+        Outermorphism() : matrixData() {
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                matrix(grade).setIdentity();
+        }
+
+        /// \brief compile a versor: the column i of the matrix of grade k is V * e_i * ~V, e_i being the basis k-vector i
+        /// \param versor - the versor V, normalized such that V * ~V = 1 for a rigid transformation
+        explicit Outermorphism(const Mvec<T> &versor) : matrixData() {
+            const Mvec<T> versorReverse = versor.reverse();
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                for(unsigned int i=0; i<binomialArray[grade]; ++i){
+                    const Mvec<T> transformedBasis = (versor * Mvec<T>().componentToOne(grade, i)).productGrade(grade, versorReverse); // the sandwich keeps the grade
+                    matrix(grade).col(i) = transformedBasis.kvec(grade);
+                }
+        }
+
+        /// \brief view on the matrix of a grade
+        /// \param grade - the grade
+        /// \return the binomialArray[grade] x binomialArray[grade] matrix applied to the k-vectors of this grade
+        inline MatrixRef<T> matrix(const unsigned int grade){
+            return MatrixRef<T>(matrixData.data() + perGradeMatrixStartingIndex[grade], binomialArray[grade], binomialArray[grade]);
+        }
+
+        /// \brief read-only view on the matrix of a grade
+        /// \param grade - the grade
+        /// \return the binomialArray[grade] x binomialArray[grade] matrix applied to the k-vectors of this grade
+        inline ConstMatrixRef<T> matrix(const unsigned int grade) const{
+            return ConstMatrixRef<T>(matrixData.data() + perGradeMatrixStartingIndex[grade], binomialArray[grade], binomialArray[grade]);
+        }
+
+        /// \brief transform a multivector, in a given multivector
+        /// \param mvResult - output, its previous content is replaced by V * mv * ~V (it can be mv)
+        /// \param mv - the transformed multivector
+        void apply(Mvec<T> &mvResult, const Mvec<T> &mv) const {
+            Mvec<T> mvTransformed;
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+                if(mv.isEmpty() || !mv.isGrade(grade))
+                    continue;
+                mvTransformed.createVectorXdIfDoesNotExist(grade).noalias() = matrix(grade) * mv.kvec(grade);
+                mvTransformed.removeGradeIfZero(grade);
+            }
+            mvResult = mvTransformed;
+        }
+
+        /// \brief transform a multivector
+        /// \param mv - the transformed multivector
+        /// \return V * mv * ~V
+        inline Mvec<T> operator()(const Mvec<T> &mv) const {
+            Mvec<T> mvResult;
+            apply(mvResult, mv);
+            return mvResult;
+        }
+
+        /// \brief composition of two outermorphisms, same as the outermorphism of the product of their versors
+        /// \param outermorphism - the outermorphism applied first
+        /// \return the outermorphism applying outermorphism, then this one
+        Outermorphism operator*(const Outermorphism &outermorphism) const {
+            Outermorphism composition;
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                composition.matrix(grade).noalias() = matrix(grade) * outermorphism.matrix(grade);
+            return composition;
+        }
+    };
+
+
+    /*!
+     * @namespace batch
+     * @brief operations on arrays of k-vectors stored as structures of arrays
+     */
+    namespace batch{
+
+        /// \brief Transform a batch of n k-vectors by an outermorphism, the product matrix-vector of each k-vector is
+        /// vectorized over the k-vectors
+        /// \tparam K - grade of the k-vectors of mv
+        /// \param outermorphism - the outermorphism of a versor V
+        /// \param mv - the batch, binomialArray[K] arrays of n coefficients
+        /// \param mvResult - output, binomialArray[K] arrays of n coefficients, V * mv[j] * ~V, must not overlap mv
+        /// \param n - number of k-vectors in the batch
+        template<unsigned int K, typename T>
+        inline void transform(const Outermorphism<T> &outermorphism, const T* __restrict mv, T* __restrict mvResult, const std::size_t n){
+            T matrix[binomialArray[K]][binomialArray[K]];
+            for(unsigned int row=0; row<binomialArray[K]; ++row)
+                for(unsigned int col=0; col<binomialArray[K]; ++col)
+                    matrix[row][col] = outermorphism.matrix(K).coeff(row, col);
+
+            C3GA_BATCH_LOOP
+            for(std::size_t j=0; j<n; ++j){
+                const KVector<T, K> kvector = load<T, K>(mv, n, j);
+                KVector<T, K> kvectorResult;
+                for(unsigned int row=0; row<binomialArray[K]; ++row){
+                    T sum = T(0);
+                    for(unsigned int col=0; col<binomialArray[K]; ++col)
+                        sum += matrix[row][col] * kvector.coeff(col);
+                    kvectorResult.coeffRef(row) = sum;
+                }
+                store(kvectorResult, mvResult, n, j);
+            }
+        }
+
+    }/// End of Namespace batch
+
+}/// End of Namespace
+
+#endif // C3GA_OUTERMORPHISM_HPP__
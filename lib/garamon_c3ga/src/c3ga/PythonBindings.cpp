@@ -11,13 +11,35 @@
 /// \file PythonBindings.cpp
 /// \author Lars Tingelstad
 /// \brief Python bindings using pybind11.
+/// The submodule batch works on NumPy arrays of n multivectors without any Python object per multivector: an array
+/// of shape (n, 32) for full multivectors (the columns in the order of the coefficients of Mvec, grade by grade,
+/// see batch.column), or of shape (n, binomialArray[k]) for k-vectors. The arrays are read and written in Fortran
+/// order, which is the layout of the batches of Batch.hpp (one array of n values per coefficient). The arguments
+/// are never copied: they must be arrays of float64 in this order (numpy.asfortranarray, and every array returned by
+/// batch), the others raise a ValueError. For instance:
+/// \code
+///     spheres = c3ga_py.batch.dual_spheres(centers, radii)                 # (n, 5)
+///     circles = c3ga_py.batch.outer(spheres, 1, other_spheres, 1)          # (n, 10)
+///     squares = c3ga_py.batch.inner(circles, 2, circles, 2)                # (n, 1), negative for real circles
+/// \endcode
 
 #include "c3ga/Mvec.hpp"
+#include "c3ga/Batch.hpp"
+#include "c3ga/BatchDispatch.hpp"
 
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/iostream.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace py = pybind11;
 
 
@@ -26,6 +48,181 @@ namespace py = pybind11;
  */
 namespace c3ga {
 
+using BatchArray = py::array_t<double, py::array::f_style>; /*!< batch of n multivectors or k-vectors, shape (n, nb coefficients), one column after another */
+
+/// \cond DEV
+/// \brief call f with the grade, as a std::integral_constant, for a grade known at run time
+/// \param grade - the grade, in [0, algebraDimension]
+/// \param f - generic function taking the grade as a type
+template<typename F, unsigned int... Grades>
+inline void withGrade(const unsigned int grade, const F &f, std::integer_sequence<unsigned int, Grades...>){
+  ((grade == Grades ? f(std::integral_constant<unsigned int, Grades>()) : void()), ...);
+}
+
+template<typename F>
+inline void withGrade(const unsigned int grade, const F &f){
+  withGrade(grade, f, std::make_integer_sequence<unsigned int, algebraDimension + 1>());
+}
+
+/// \brief tell whether the geometric product of two k-vectors of grades grade1 and grade2 has a part of grade grade3
+constexpr bool geometricHasGrade(const unsigned int grade3, const unsigned int grade1, const unsigned int grade2){
+  const unsigned int gradeOuter = grade1 + grade2;
+  const unsigned int gradeInner = grade1 > grade2 ? grade1 - grade2 : grade2 - grade1;
+  return grade3 >= gradeInner && grade3 <= gradeOuter && (grade3 - gradeInner) % 2 == 0 && grade3 + gradeOuter <= 2*algebraDimension;
+}
+
+/// \brief throw a ValueError if a grade is out of the algebra
+inline void checkGrade(const unsigned int grade){
+  if(grade > algebraDimension)
+    throw py::value_error("the grade must be in [0, " + std::to_string(algebraDimension) + "]");
+}
+
+/// \brief the batch given as argument, without copy, throw a ValueError if it is not an array of float64 in Fortran order
+/// (array_t would silently convert it, and a view returned on the converted array would not alias the argument)
+inline BatchArray batchArgument(const py::array &mv, const char *name){
+  if(!BatchArray::check_(mv))
+    throw py::value_error(std::string(name) + " must be an array of float64 in Fortran order (numpy.asfortranarray)");
+  return py::reinterpret_borrow<BatchArray>(mv);
+}
+
+/// \brief number of rows of a batch, throw a ValueError if its shape is not (n, nbColumns)
+inline std::size_t batchSize(const BatchArray &mv, const unsigned int nbColumns){
+  if(mv.ndim() != 2 || mv.shape(1) != py::ssize_t(nbColumns))
+    throw py::value_error("expected an array of shape (n, " + std::to_string(nbColumns) + ")");
+  return std::size_t(mv.shape(0));
+}
+
+/// \brief number of rows of two batches, throw a ValueError if their shapes are not (n, nbColumns1) and (n, nbColumns2)
+inline std::size_t batchSize(const BatchArray &mv1, const unsigned int nbColumns1, const BatchArray &mv2, const unsigned int nbColumns2){
+  const std::size_t n = batchSize(mv1, nbColumns1);
+  if(batchSize(mv2, nbColumns2) != n)
+    throw py::value_error("the two arrays must have the same number of rows");
+  return n;
+}
+
+/// \brief new batch of shape (n, nbColumns), in Fortran order
+inline BatchArray newBatch(const std::size_t n, const unsigned int nbColumns){
+  return BatchArray({py::ssize_t(n), py::ssize_t(nbColumns)});
+}
+
+// products of batches of k-vectors of grades known at run time, the grade grade3 of the result is computed in mv3
+// (binomialArray[grade3] arrays of n values), return false if the product has no part of grade grade3
+
+inline bool outerGrades(const unsigned int grade1, const unsigned int grade2, const unsigned int grade3,
+                        const double *mv1, const double *mv2, double *mv3, const std::size_t n){
+  if(grade3 != grade1 + grade2)
+    return false;
+  withGrade(grade1, [&](auto gradeMv1){ withGrade(grade2, [&](auto gradeMv2){
+    constexpr unsigned int GradeMv1 = decltype(gradeMv1)::value, GradeMv2 = decltype(gradeMv2)::value;
+    if constexpr(GradeMv1 + GradeMv2 <= algebraDimension)
+      batch::invoke([&]{ batch::outer<GradeMv1, GradeMv2>(mv1, mv2, mv3, n); });
+  });});
+  return true;
+}
+
+inline bool innerGrades(const unsigned int grade1, const unsigned int grade2, const unsigned int grade3,
+                        const double *mv1, const double *mv2, double *mv3, const std::size_t n){
+  if(grade3 != (grade1 > grade2 ? grade1 - grade2 : grade2 - grade1))
+    return false;
+  withGrade(grade1, [&](auto gradeMv1){ withGrade(grade2, [&](auto gradeMv2){
+    batch::invoke([&]{ batch::inner<decltype(gradeMv1)::value, decltype(gradeMv2)::value>(mv1, mv2, mv3, n); });
+  });});
+  return true;
+}
+
+inline bool geometricGrades(const unsigned int grade1, const unsigned int grade2, const unsigned int grade3,
+                            const double *mv1, const double *mv2, double *mv3, const std::size_t n){
+  if(!geometricHasGrade(grade3, grade1, grade2))
+    return false;
+  withGrade(grade1, [&](auto gradeMv1){ withGrade(grade2, [&](auto gradeMv2){ withGrade(grade3, [&](auto gradeMv3){
+    constexpr unsigned int GradeMv1 = decltype(gradeMv1)::value, GradeMv2 = decltype(gradeMv2)::value, GradeMv3 = decltype(gradeMv3)::value;
+    if constexpr(geometricHasGrade(GradeMv3, GradeMv1, GradeMv2))
+      batch::invoke([&]{ batch::geometric<GradeMv3, GradeMv1, GradeMv2>(mv1, mv2, mv3, n); });
+  });});});
+  return true;
+}
+
+/// \brief product of two batches of k-vectors
+/// \param products - one of outerGrades, innerGrades or geometricGrades
+/// \return the batch of the part of grade grade3 of the products, ValueError if the product has no such part
+template<typename Products>
+BatchArray productBatch(const Products &products, const BatchArray &mv1, const unsigned int grade1,
+                        const BatchArray &mv2, const unsigned int grade2, const unsigned int grade3){
+  checkGrade(grade1); checkGrade(grade2); checkGrade(grade3);
+  const std::size_t n = batchSize(mv1, binomialArray[grade1], mv2, binomialArray[grade2]);
+  BatchArray mv3 = newBatch(n, binomialArray[grade3]);
+  const double *data1 = mv1.data(), *data2 = mv2.data();
+  double *data3 = mv3.mutable_data();
+  bool computed;
+  {
+    py::gil_scoped_release release;
+    computed = products(grade1, grade2, grade3, data1, data2, data3, n);
+  }
+  if(!computed)
+    throw py::value_error("the product of these grades has no part of grade " + std::to_string(grade3));
+  return mv3;
+}
+
+/// \brief product of two batches of full multivectors, the sum of the products of their grades (the grade 0 is skipped
+/// by the inner product, as with Mvec)
+/// \param products - one of outerGrades, innerGrades or geometricGrades
+/// \param firstGrade - the first grade of mv1 and mv2 used
+/// \return the batch of the full products
+template<typename Products>
+BatchArray productFull(const Products &products, const unsigned int firstGrade, const BatchArray &mv1, const BatchArray &mv2){
+  const std::size_t n = batchSize(mv1, nbCoefficients, mv2, nbCoefficients);
+  BatchArray mv3 = newBatch(n, nbCoefficients);
+  const double *data1 = mv1.data(), *data2 = mv2.data();
+  double *data3 = mv3.mutable_data();
+  {
+    py::gil_scoped_release release;
+    std::vector<double> product(binomialArray[algebraDimension/2] * n);
+    std::fill(data3, data3 + nbCoefficients*n, 0.0);
+    for(unsigned int grade1=firstGrade; grade1<=algebraDimension; ++grade1)
+      for(unsigned int grade2=firstGrade; grade2<=algebraDimension; ++grade2)
+        for(unsigned int grade3=0; grade3<=algebraDimension; ++grade3){
+          if(!products(grade1, grade2, grade3, data1 + perGradeStartingIndex[grade1]*n, data2 + perGradeStartingIndex[grade2]*n, product.data(), n))
+            continue;
+          double *slot = data3 + perGradeStartingIndex[grade3]*n;
+          for(std::size_t i=0; i<binomialArray[grade3]*n; ++i)
+            slot[i] += product[i];
+        }
+  }
+  return mv3;
+}
+
+/// \brief duals of a batch of k-vectors, of grade algebraDimension - grade
+inline void dualGrade(const unsigned int grade, const double *mv, double *dualMv, const std::size_t n){
+  withGrade(grade, [&](auto gradeMv){
+    batch::invoke([&]{ batch::dual<decltype(gradeMv)::value>(mv, dualMv, n); });
+  });
+}
+
+/// \brief coefficients of points or dual spheres: e0 + x e1 + y e2 + z e3 + 0.5 (x^2 + y^2 + z^2 - r^2) ei
+/// \param centers - array of shape (n, 3)
+/// \param squaredRadii - the n squared radii, or nullptr for points
+inline BatchArray dualSpheresBatch(const BatchArray &centers, const double *squaredRadii){
+  const std::size_t n = batchSize(centers, 3);
+  BatchArray dualSpheres = newBatch(n, binomialArray[1]);
+  const double *x = centers.data(), *y = x + n, *z = y + n;
+  double *data = dualSpheres.mutable_data();
+  {
+    py::gil_scoped_release release;
+    C3GA_BATCH_LOOP
+    for(std::size_t j=0; j<n; ++j){
+      data[j] = 1.0;
+      data[n + j] = x[j];
+      data[2*n + j] = y[j];
+      data[3*n + j] = z[j];
+      data[4*n + j] = 0.5 * (x[j]*x[j] + y[j]*y[j] + z[j]*z[j]);
+      if(squaredRadii)
+        data[4*n + j] -= 0.5 * squaredRadii[j];
+    }
+  }
+  return dualSpheres;
+}
+/// \endcond
+
 PYBIND11_MODULE(c3ga_py, m) {
 
   m.attr("E0") = 1;
@@ -184,6 +381,106 @@ m.def("e0123i", &e0123i<double>);
   mvec.def("grade", [](const Mvec<double>& a, const int i){return a.grade(i);});
   mvec.def("clear", &Mvec<double>::clear);
 
+
+  // Batches of multivectors (NumPy arrays)
+  auto batchModule = m.def_submodule("batch", "products of arrays of n multivectors, shape (n, 32), or k-vectors, shape (n, binomial(5, k))");
+
+  batchModule.def("column",
+      [](const unsigned int xorIndex) {
+        if(xorIndex >= nbCoefficients)
+          throw py::value_error("the index must be in [0, 31]");
+        return perGradeStartingIndex[xorIndexToGrade[xorIndex]] + xorIndexToHomogeneousIndex[xorIndex];
+      }, py::arg("xor_index"), "column of the coefficient of a basis blade (E0, E12, ...) in an array of full multivectors");
+
+  batchModule.def("grade",
+      [](const py::array& mvArgument, const unsigned int grade) {
+        const BatchArray mv = batchArgument(mvArgument, "mv");
+        checkGrade(grade);
+        const std::size_t n = batchSize(mv, nbCoefficients);
+        return py::array_t<double>({py::ssize_t(n), py::ssize_t(binomialArray[grade])},
+                                   {py::ssize_t(sizeof(double)), py::ssize_t(n*sizeof(double))},
+                                   mv.data() + perGradeStartingIndex[grade]*n, mv); // a view, the columns of a grade are consecutive
+      }, py::arg("mv"), py::arg("grade"), "view (without copy) on the k-vectors of grade k of an array of full multivectors");
+
+  batchModule.def("multivectors",
+      [](const py::array& kvectorsArgument, const unsigned int grade) {
+        const BatchArray kvectors = batchArgument(kvectorsArgument, "kvectors");
+        checkGrade(grade);
+        const std::size_t n = batchSize(kvectors, binomialArray[grade]);
+        BatchArray mv = newBatch(n, nbCoefficients);
+        std::fill(mv.mutable_data(), mv.mutable_data() + nbCoefficients*n, 0.0);
+        std::copy(kvectors.data(), kvectors.data() + binomialArray[grade]*n, mv.mutable_data() + perGradeStartingIndex[grade]*n);
+        return mv;
+      }, py::arg("kvectors"), py::arg("grade"), "full multivectors of an array of k-vectors of grade k");
+
+  batchModule.def("outer",
+      [](const py::array& mv1, const unsigned int grade1, const py::array& mv2, const unsigned int grade2) {
+        return productBatch(outerGrades, batchArgument(mv1, "mv1"), grade1, batchArgument(mv2, "mv2"), grade2, grade1 + grade2);
+      }, py::arg("mv1"), py::arg("grade1"), py::arg("mv2"), py::arg("grade2"), "outer products of k-vectors, same values as Mvec");
+  batchModule.def("outer",
+      [](const py::array& mv1, const py::array& mv2) { return productFull(outerGrades, 0, batchArgument(mv1, "mv1"), batchArgument(mv2, "mv2")); },
+      py::arg("mv1"), py::arg("mv2"), "outer products of full multivectors");
+
+  batchModule.def("inner",
+      [](const py::array& mv1, const unsigned int grade1, const py::array& mv2, const unsigned int grade2) {
+        return productBatch(innerGrades, batchArgument(mv1, "mv1"), grade1, batchArgument(mv2, "mv2"), grade2, grade1 > grade2 ? grade1 - grade2 : grade2 - grade1);
+      }, py::arg("mv1"), py::arg("grade1"), py::arg("mv2"), py::arg("grade2"), "inner products of k-vectors, same values as Mvec");
+  batchModule.def("inner",
+      [](const py::array& mv1, const py::array& mv2) { return productFull(innerGrades, 1, batchArgument(mv1, "mv1"), batchArgument(mv2, "mv2")); },
+      py::arg("mv1"), py::arg("mv2"), "inner products of full multivectors");
+
+  batchModule.def("geometric",
+      [](const py::array& mv1, const unsigned int grade1, const py::array& mv2, const unsigned int grade2, const unsigned int grade3) {
+        return productBatch(geometricGrades, batchArgument(mv1, "mv1"), grade1, batchArgument(mv2, "mv2"), grade2, grade3);
+      }, py::arg("mv1"), py::arg("grade1"), py::arg("mv2"), py::arg("grade2"), py::arg("grade"),
+      "part of a grade of the geometric products of k-vectors, same values as Mvec::productGrade");
+  batchModule.def("geometric",
+      [](const py::array& mv1, const py::array& mv2) { return productFull(geometricGrades, 0, batchArgument(mv1, "mv1"), batchArgument(mv2, "mv2")); },
+      py::arg("mv1"), py::arg("mv2"), "geometric products of full multivectors");
+
+  batchModule.def("dual",
+      [](const py::array& mvArgument, const unsigned int grade) {
+        const BatchArray mv = batchArgument(mvArgument, "mv");
+        checkGrade(grade);
+        const std::size_t n = batchSize(mv, binomialArray[grade]);
+        BatchArray dualMv = newBatch(n, binomialArray[algebraDimension - grade]);
+        {
+          py::gil_scoped_release release;
+          dualGrade(grade, mv.data(), dualMv.mutable_data(), n);
+        }
+        return dualMv;
+      }, py::arg("mv"), py::arg("grade"), "duals of k-vectors, of grade 5 - k, same values as Mvec::dual");
+  batchModule.def("dual",
+      [](const py::array& mvArgument) {
+        const BatchArray mv = batchArgument(mvArgument, "mv");
+        const std::size_t n = batchSize(mv, nbCoefficients);
+        BatchArray dualMv = newBatch(n, nbCoefficients);
+        const double *data = mv.data();
+        double *dualData = dualMv.mutable_data();
+        {
+          py::gil_scoped_release release;
+          for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            dualGrade(grade, data + perGradeStartingIndex[grade]*n, dualData + perGradeStartingIndex[algebraDimension - grade]*n, n);
+        }
+        return dualMv;
+      }, py::arg("mv"), "duals of full multivectors");
+
+  batchModule.def("points",
+      [](const py::array& coordinates) { return dualSpheresBatch(batchArgument(coordinates, "coordinates"), nullptr); },
+      py::arg("coordinates"), "points of an array of shape (n, 3), shape (n, 5)");
+
+  batchModule.def("dual_spheres",
+      [](const py::array& centersArgument, const py::array& radiiArgument) {
+        const BatchArray centers = batchArgument(centersArgument, "centers"), radii = batchArgument(radiiArgument, "radii");
+        const std::size_t n = batchSize(centers, 3);
+        if(radii.ndim() != 1 || std::size_t(radii.shape(0)) != n)
+          throw py::value_error("expected one radius per center");
+        std::vector<double> squaredRadii(n);
+        for(std::size_t j=0; j<n; ++j)
+          squaredRadii[j] = radii.data()[j] * radii.data()[j];
+        return dualSpheresBatch(centers, squaredRadii.data());
+      }, py::arg("centers"), py::arg("radii"), "dual spheres of centers, shape (n, 3), and radii, shape (n), shape (n, 5)");
+
 }
 
 }  // namespace c3ga
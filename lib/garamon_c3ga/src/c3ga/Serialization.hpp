@@ -0,0 +1,321 @@
+// Copyright (c) 2018 by University Paris-Est Marne-la-Vallee
+// Serialization.hpp
+// This file is part of the Garamon for c3ga.
+// Authors: Stephane Breuils and Vincent Nozick
+// Contact: vincent.nozick@u-pem.fr
+//
+// Licence MIT
+// A a copy of the MIT License is given along with this program
+
+/// \file Serialization.hpp
+/// \author Stephane Breuils, Vincent Nozick
+/// \brief Compact binary encoding of sequences of multivectors, in the Geometric algebra of c3ga.
+/// A sequence starts with a header of 8 bytes: "C3GA", the version of the format (1), the size of the stored
+/// coefficients (8 for double, 4 for float) and 2 bytes to 0. Then each multivector is its grade bitmap (1 byte, bit k
+/// set if the multivector contains the grade k), followed by the coefficients of its grades, grade by grade in the
+/// order of Mvec, in little endian IEEE 754: a dual sphere takes 41 bytes in double, 21 bytes in float.
+/// MvecWriter appends multivectors to a stream (a file) or to a buffer, MvecReader reads them back. Both go through
+/// a block of memory allocated once, there is no allocation per multivector. For instance:
+/// \code
+///     std::ofstream file("spheres.c3ga", std::ios::binary);
+///     c3ga::MvecWriter<float> writer(file); // coefficients rounded to float
+///     for(const auto &sphere : dualSpheres)
+///         writer.write(sphere);
+///     writer.flush();
+///     ...
+///     std::ifstream input("spheres.c3ga", std::ios::binary);
+///     c3ga::MvecReader reader(input);
+///     std::vector<c3ga::Mvec<double>> spheres(1000);
+///     const std::size_t nbRead = reader.read(spheres.data(), spheres.size());
+/// \endcode
+/// The multivectors read are the same as the written ones (rounded to float if written in float).
+
+
+// Anti-doublon
+#ifndef C3GA_SERIALIZATION_HPP__
+#define C3GA_SERIALIZATION_HPP__
+#pragma once
+
+// External Includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+// Internal Includes
+#include "c3ga/Mvec.hpp"
+
+/*!
+ * @namespace c3ga
+ */
+namespace c3ga{
+
+    constexpr unsigned char serializationMagic[4] = {'C', '3', 'G', 'A'}; /*!< first bytes of a sequence of multivectors */
+
+    constexpr unsigned char serializationVersion = 1; /*!< version of the binary encoding */
+
+    constexpr std::size_t serializationHeaderSize = 8; /*!< size in bytes of the header of a sequence of multivectors */
+
+    constexpr std::size_t serializationBlockSize = 1 << 16; /*!< size in bytes of the blocks of MvecWriter and MvecReader */
+
+    /// \cond DEV
+    // unsigned integer of the same size as a coefficient, to get its bytes
+    template<typename Stored>
+    using SerializationBits = std::conditional_t<sizeof(Stored) == 8, std::uint64_t, std::uint32_t>;
+
+    /// \brief write a coefficient in little endian, return the next byte
+    template<typename Stored>
+    inline unsigned char* encodeCoefficient(const Stored value, unsigned char *bytes){
+        SerializationBits<Stored> bits;
+        std::memcpy(&bits, &value, sizeof(Stored));
+        for(unsigned int i=0; i<sizeof(Stored); ++i)
+            bytes[i] = static_cast<unsigned char>(bits >> (8*i));
+        return bytes + sizeof(Stored);
+    }
+
+    /// \brief read a coefficient in little endian, return the next byte
+    template<typename Stored>
+    inline const unsigned char* decodeCoefficient(const unsigned char *bytes, Stored &value){
+        SerializationBits<Stored> bits = 0;
+        for(unsigned int i=0; i<sizeof(Stored); ++i)
+            bits |= SerializationBits<Stored>(bytes[i]) << (8*i);
+        std::memcpy(&value, &bits, sizeof(Stored));
+        return bytes + sizeof(Stored);
+    }
+
+    /// \brief number of bytes of the coefficients of the grades of a grade bitmap
+    inline std::size_t serializedCoefficientsSize(const unsigned int gradeBitmap, const std::size_t coefficientSize){
+        std::size_t nbStoredCoefficients = 0;
+        for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+            if(gradeBitmap & (1<<grade))
+                nbStoredCoefficients += binomialArray[grade];
+        return nbStoredCoefficients * coefficientSize;
+    }
+    /// \endcond
+
+
+    /// \class MvecWriter
+    /// \brief appends multivectors to a stream or a buffer, in the binary encoding of Serialization.hpp
+    /// \tparam Stored - type of the stored coefficients, double, or float to halve the size (the coefficients are rounded)
+    template<typename Stored = double>
+    class MvecWriter {
+
+        static_assert(std::is_same<Stored, double>::value || std::is_same<Stored, float>::value, "the coefficients are stored in double or in float");
+
+    protected:
+        std::ostream *stream;                /*!< destination, or nullptr when writing to buffer */
+        std::vector<unsigned char> *buffer;  /*!< destination, or nullptr when writing to stream */
+        std::vector<unsigned char> block;    /*!< encoded multivectors not yet given to the destination */
+        std::size_t blockSize;               /*!< number of used bytes of block */
+        std::size_t nbWritten;               /*!< number of multivectors written */
+
+        static constexpr std::size_t maxRecordSize = 1 + nbCoefficients * sizeof(Stored); /*!< size of a multivector with every grade */
+
+    public:
+
+        /// \brief start a sequence of multivectors in a stream, the header is written
+        /// \param stream - the destination, opened in binary mode for a file; it must outlive the writer
+        explicit MvecWriter(std::ostream &stream) : stream(&stream), buffer(nullptr), block(serializationBlockSize), blockSize(0), nbWritten(0) {
+            writeHeader();
+        }
+
+        /// \brief start a sequence of multivectors at the end of a buffer, the header is appended
+        /// \param buffer - the destination; it must outlive the writer
+        explicit MvecWriter(std::vector<unsigned char> &buffer) : stream(nullptr), buffer(&buffer), block(serializationBlockSize), blockSize(0), nbWritten(0) {
+            writeHeader();
+        }
+
+        MvecWriter(const MvecWriter&) = delete;
+        MvecWriter& operator=(const MvecWriter&) = delete;
+
+        /// \brief give the remaining multivectors to the destination
+        ~MvecWriter(){
+            flush();
+        }
+
+        /// \brief append a multivector (its coefficients are converted to Stored)
+        /// \param mv - the multivector
+        template<typename T>
+        void write(const Mvec<T> &mv){
+            if(blockSize + maxRecordSize > block.size())
+                flush();
+            unsigned int gradeBitmap = 0;
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade)
+                if(!mv.isEmpty() && mv.isGrade(grade))
+                    gradeBitmap |= 1 << grade;
+            unsigned char *bytes = block.data() + blockSize;
+            *bytes++ = static_cast<unsigned char>(gradeBitmap);
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+                if(!(gradeBitmap & (1<<grade)))
+                    continue;
+                const ConstKvecRef<T> kvector = mv.kvec(grade);
+                for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                    bytes = encodeCoefficient(Stored(kvector.coeff(i)), bytes);
+            }
+            blockSize = bytes - block.data();
+            ++nbWritten;
+        }
+
+        /// \brief append an array of multivectors
+        /// \param mvs - the multivectors
+        /// \param n - number of multivectors
+        template<typename T>
+        void write(const Mvec<T> *mvs, const std::size_t n){
+            for(std::size_t j=0; j<n; ++j)
+                write(mvs[j]);
+        }
+
+        /// \brief give the multivectors written so far to the destination (the stream is not flushed)
+        void flush(){
+            if(blockSize == 0)
+                return;
+            if(stream)
+                stream->write(reinterpret_cast<const char*>(block.data()), std::streamsize(blockSize));
+            else
+                buffer->insert(buffer->end(), block.begin(), block.begin() + blockSize);
+            blockSize = 0;
+        }
+
+        /// \brief number of multivectors written
+        inline std::size_t count() const {
+            return nbWritten;
+        }
+
+    protected:
+        void writeHeader(){
+            std::memcpy(block.data(), serializationMagic, 4);
+            block[4] = serializationVersion;
+            block[5] = static_cast<unsigned char>(sizeof(Stored));
+            block[6] = block[7] = 0;
+            blockSize = serializationHeaderSize;
+        }
+    };
+
+
+    /// \class MvecReader
+    /// \brief reads the multivectors of a stream or a buffer written by MvecWriter, in double or in float
+    class MvecReader {
+
+    protected:
+        std::istream *stream;                /*!< source, or nullptr when reading a buffer */
+        std::vector<unsigned char> block;    /*!< bytes read from stream and not decoded yet (unused for a buffer) */
+        const unsigned char *current;        /*!< next byte to decode */
+        const unsigned char *end;            /*!< end of the bytes available (in block, or the end of the buffer) */
+        std::size_t coefficientSize;         /*!< size of the stored coefficients, 8 or 4 */
+        bool valid;                          /*!< false if the header is not the one of MvecWriter or if the data is truncated */
+
+    public:
+
+        /// \brief start to read a sequence of multivectors from a stream, the header is read
+        /// \param stream - the source, opened in binary mode for a file; it must outlive the reader
+        explicit MvecReader(std::istream &stream) : stream(&stream), block(serializationBlockSize), current(block.data()), end(block.data()), coefficientSize(0), valid(true) {
+            readHeader();
+        }
+
+        /// \brief start to read a sequence of multivectors from a buffer, the header is read
+        /// \param data - the bytes written by MvecWriter; they must outlive the reader
+        /// \param size - number of bytes
+        MvecReader(const unsigned char *data, const std::size_t size) : stream(nullptr), current(data), end(data + size), coefficientSize(0), valid(true) {
+            readHeader();
+        }
+
+        MvecReader(const MvecReader&) = delete;
+        MvecReader& operator=(const MvecReader&) = delete;
+
+        /// \brief tell whether the sequence is valid so far
+        /// \return false if the header is not the one of MvecWriter or if the last multivector is truncated
+        inline bool good() const {
+            return valid;
+        }
+
+        /// \brief tell whether the coefficients are stored in float
+        inline bool isFloat() const {
+            return coefficientSize == sizeof(float);
+        }
+
+        /// \brief read the next multivector, in place
+        /// \param mv - output, its previous content is replaced (no allocation)
+        /// \return false at the end of the sequence or if it is not valid (mv is then left unchanged)
+        template<typename T>
+        bool read(Mvec<T> &mv){
+            if(!available(1))
+                return false;
+            const unsigned int gradeBitmap = *current;
+            if(gradeBitmap >> (algebraDimension + 1)){
+                valid = false;
+                return false;
+            }
+            if(!available(1 + serializedCoefficientsSize(gradeBitmap, coefficientSize))){
+                valid = false;
+                return false;
+            }
+            ++current;
+            mv.clear();
+            for(unsigned int grade=0; grade<=algebraDimension; ++grade){
+                if(!(gradeBitmap & (1<<grade)))
+                    continue;
+                KvecRef<T> kvector = mv.createVectorXdIfDoesNotExist(grade);
+                for(unsigned int i=0; i<binomialArray[grade]; ++i)
+                    kvector.coeffRef(i) = decode<T>();
+            }
+            return true;
+        }
+
+        /// \brief read the next multivectors into an array, in place
+        /// \param mvs - output, at least n multivectors
+        /// \param n - maximum number of multivectors read
+        /// \return the number of multivectors read, less than n at the end of the sequence or if it is not valid
+        template<typename T>
+        std::size_t read(Mvec<T> *mvs, const std::size_t n){
+            std::size_t nbRead = 0;
+            while(nbRead < n && read(mvs[nbRead]))
+                ++nbRead;
+            return nbRead;
+        }
+
+    protected:
+        /// \brief make at least size bytes available after current if the source has them, refilling block from stream
+        /// \return true if they are available
+        bool available(const std::size_t size){
+            if(!valid)
+                return false;
+            if(std::size_t(end - current) >= size || !stream)
+                return std::size_t(end - current) >= size;
+            const std::size_t remaining = end - current;
+            std::memmove(block.data(), current, remaining);
+            stream->read(reinterpret_cast<char*>(block.data() + remaining), std::streamsize(block.size() - remaining));
+            current = block.data();
+            end = block.data() + remaining + std::size_t(stream->gcount());
+            return std::size_t(end - current) >= size;
+        }
+
+        /// \brief decode the coefficient at current, converted to T
+        template<typename T>
+        inline T decode(){
+            if(coefficientSize == sizeof(float)){
+                float value;
+                current = decodeCoefficient(current, value);
+                return T(value);
+            }
+            double value;
+            current = decodeCoefficient(current, value);
+            return T(value);
+        }
+
+        void readHeader(){
+            if(!available(serializationHeaderSize) || std::memcmp(current, serializationMagic, 4) != 0 || current[4] != serializationVersion
+               || (current[5] != sizeof(double) && current[5] != sizeof(float))){
+                valid = false;
+                return;
+            }
+            coefficientSize = current[5];
+            current += serializationHeaderSize;
+        }
+    };
+
+}/// End of Namespace
+
+#endif // C3GA_SERIALIZATION_HPP__
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "PlanetSystem.hpp"
+
+
+/* Pair of planet indexes (first < second) that may be colliding */
+typedef std::pair<int, int> CandidatePair;
+
+
+/* Broad phase of the collision detection: quickly find the pairs of planets that
+ * may collide, before running the (expensive) CGA test on each of them */
+class BroadPhase {
+    public:
+    virtual ~BroadPhase() {}
+
+    /** Compute every candidate pairs of the given planets
+     * @param planets every planets
+     * @param pairs output vector, filled with pairs (i, j) with i < j, sorted */
+    virtual void findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) = 0;
+};
+
+
+/* Every planet against every other planet, used as a reference */
+class BruteForce : public BroadPhase {
+    public:
+    void findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) override {
+        pairs.clear();
+        for(size_t i=0; i<planets.size(); i++) {
+            for(size_t j=i+1; j<planets.size(); j++) {
+                pairs.push_back(CandidatePair(i, j));
+            }
+        }
+    }
+};
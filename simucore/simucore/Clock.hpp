@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+
+
+/* Source of time used by the simulation (in seconds), never set back: the pauses are taken out by Info */
+struct Clock {
+    virtual ~Clock() {}
+
+    /*get the current time*/
+    virtual double now() const = 0;
+};
+
+
+/* Monotonic clock, in seconds since its creation. now() can be called from any thread, so it drives the
+ * simulation thread while the render thread reads its own clock. */
+struct SteadyClock : public Clock {
+    private:
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    public:
+    double now() const override {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+
+/* Clock that only moves when asked to, so the simulation can run without any window */
+struct VirtualClock : public Clock {
+    private:
+    double current = 0.0; // current time
+
+    public:
+    VirtualClock(double start = 0.0) : current{start} {}
+
+    double now() const override {
+        return current;
+    }
+
+    /*move the time forward by dt seconds*/
+    void advance(double dt) {
+        current += dt;
+    }
+};
+
+
+/* Fixed timestep accumulator: the elapsed time of a clock is accumulated and consumed by
+ * simulation steps of a fixed duration. The number of steps per second does not depend on
+ * the frame rate, and the steps left over are drawn by interpolating between two steps. */
+struct FixedStepClock {
+    private:
+    double stepDuration; // simulated time of one step (in seconds)
+    int maxSteps; // maximum number of steps run in one frame, the late time is dropped after that
+    double accumulator = 0.0; // simulated time not consumed by a step yet
+    double lastTime = 0.0; // time of the last call to advance
+    bool started = false;
+
+    public:
+    FixedStepClock(double dt = 1.0 / 60.0, int max = 30) : stepDuration{dt}, maxSteps{max} {}
+
+    /** Accumulate the time elapsed since the last call
+     * @param now current time of the clock driving the simulation (in seconds)
+     * @param timeScale simulated time per second of the clock (0 if paused)
+     * @return the number of steps to run now, at most maxSteps */
+    int advance(double now, double timeScale) {
+        double elapsed = (started ? now - lastTime : 0.0);
+        lastTime = now; started = true;
+        if(elapsed < 0.0) elapsed = 0.0; // another clock, earlier than the last one
+        accumulator += elapsed * timeScale;
+        int steps = int(accumulator / stepDuration);
+        if(steps > maxSteps) { // too late to catch up, drop the time we cannot simulate
+            steps = maxSteps;
+            accumulator = steps * stepDuration;
+        }
+        accumulator -= steps * stepDuration;
+        return steps;
+    }
+
+    /*fraction of the next step already elapsed, in [0, 1), to draw between the last two steps*/
+    float alpha() const {
+        return float(accumulator / stepDuration);
+    }
+
+    double getStepDuration() const {
+        return stepDuration;
+    }
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <glimac/BBox.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "BroadPhase.hpp"
+
+
+/* Dynamic bounding volume hierarchy: every planet is a leaf holding a fattened box,
+ * so it can move a few steps before the tree has to change. Leaves that leave their
+ * fattened box are removed and inserted again, and the tree is kept balanced with
+ * rotations (like an AVL tree). The boxes fit planets of any size, so the pruning
+ * does not depend on the biggest planet like a grid does. */
+class DynamicTree : public BroadPhase {
+    private:
+    /* node of the tree, a leaf if child1 == -1 */
+    struct Node {
+        glimac::BBox3f box; // fattened box for leaves, union of the children boxes otherwise
+        int parent = -1;
+        int child1 = -1;
+        int child2 = -1;
+        int height = 0; // 0 for leaves
+        unsigned int id = 0; // id of the planet (leaves only)
+        int index = 0; // index of the planet in the vector, updated every step (leaves only)
+        unsigned int lastStep = 0; // last step where the planet was found (leaves only)
+
+        bool isLeaf() const {
+            return child1 == -1;
+        }
+    };
+
+    std::vector<Node> nodes; // freed nodes are recycled
+    std::vector<int> freeNodes; // indexes of the freed nodes
+    int root = -1;
+    std::unordered_map<unsigned int, int> leafOfId; // planet id -> leaf
+    std::vector<int> stack; // traversal stack, kept to avoid allocations
+    unsigned int step = 0; // number of calls to findPairs
+
+    static constexpr float fatMargin = 1.0; // margin added around the box of a planet
+    static constexpr float predictedSteps = 4.0; // the box is also extended along the movement of the planet
+
+    /*tight box around the planet i*/
+    static glimac::BBox3f planetBox(const PlanetSystem& planets, size_t i);
+
+    /*fattened box around the planet i*/
+    static glimac::BBox3f fatBox(const PlanetSystem& planets, size_t i);
+
+    /*surface area of a box, used to choose where to insert leaves*/
+    static float area(const glimac::BBox3f& box);
+
+    /*true if the box a is inside the box b*/
+    static bool contains(const glimac::BBox3f& b, const glimac::BBox3f& a);
+
+    int allocateNode();
+    void freeNode(int node);
+
+    /*place a leaf in the tree*/
+    void insertLeaf(int leaf);
+
+    /*take a leaf out of the tree (the node is not freed)*/
+    void removeLeaf(int leaf);
+
+    /*fix the boxes and heights from the given node up to the root, balancing the tree on the way*/
+    void refit(int node);
+
+    /*rotate the tree at the given node if it is unbalanced, return the new root of this subtree*/
+    int balance(int node);
+
+    public:
+    DynamicTree() {}
+
+    void findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) override;
+
+    /*height of the tree, -1 if empty*/
+    int getHeight() const {
+        return (root == -1 ? -1 : nodes[root].height);
+    }
+};
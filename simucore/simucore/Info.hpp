@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Clock.hpp"
+#include "Random.hpp"
+
+
+/* Global class containing time and various data  */
+struct Info {
+    private:
+    Clock* clock; // source of time (glfw timer or virtual clock)
+    float f_speed = 510.0; // rotation speed factor
+    double time_memory = 0.0; // time of the simulation, if paused
+    double time_paused = 0.0; // time of the clock spent in pauses, taken out of the time of the simulation
+    bool time_pause = false; // flag to know if the time is paused
+    bool draw_hitbox = false; // indicator to draw orbit of planets
+    bool special_spawn = false; // indicator to spawn a new planet
+    bool special_clean = false; // indicator to remove all small planets
+    bool log_events = true; // indicator to print collisions and special events
+    uint64_t step = 0; // number of simulation steps done, used to select random streams
+    unsigned int next_id = 0; // id of the next planet created, the ids also select random streams
+
+    public:
+    Info(Clock* c) : clock{c} {}
+
+    /*modify the speed of the simulation*/
+    void modifySpeed(float f) {
+        float t = f_speed + f;
+        if(t < 210.0 || t > 10000.0) return;
+        f_speed = t;
+    }
+
+    float getFactorSpeed() const {
+        return f_speed;
+    }
+
+    /*get the simulated time per second, 1 at the default speed*/
+    double getTimeScale() const {
+        return f_speed / 510.0;
+    }
+
+    bool isPaused() const {
+        return time_pause;
+    }
+
+    /*pause/resume the time of the simulation (the clock itself goes on)*/
+    void pauseTime() {
+        if(time_pause) {
+            time_pause = false;
+            time_paused = clock->now() - time_memory;
+        }
+        else {
+            time_pause = true;
+            time_memory = getTime();
+        }
+    }
+
+    /*get the time of the simulation*/
+    double getTime() const {
+        if(time_pause) return time_memory;
+        return clock->now() - time_paused;
+    }
+
+    /*set the random seed, the planet ids start again from 0 so the same seed gives the same simulation*/
+    void setSeed(uint64_t seed) {
+        Random::setSeed(seed);
+        next_id = 0;
+    }
+
+    /*get a new planet id, unique in this simulation*/
+    unsigned int newPlanetId() {
+        return next_id++;
+    }
+
+    /*get the number of simulation steps done*/
+    uint64_t getStep() const {
+        return step;
+    }
+
+    /*count one more simulation step*/
+    void nextStep() {
+        step++;
+    }
+
+    /*to know if we have to draw the orbit or not*/
+    bool drawHitbox() const {
+        return draw_hitbox;
+    }
+
+    /*inverse the draw_orbit flag*/
+    void modifyDrawHitbox() {
+        draw_hitbox = !draw_hitbox;
+    }
+
+    /*to know if we have to activate the special spawn*/
+    bool specialSpawn() const {
+        return special_spawn;
+    }
+
+    /*inverse the special_spawn flag*/
+    void modifySpecialSpawn() {
+        special_spawn = !special_spawn;
+    }
+
+    /*to know if we have to activate the special clean*/
+    bool specialClean() const {
+        return special_clean;
+    }
+
+    /*inverse the special_clean flag*/
+    void modifySpecialClean() {
+        special_clean = !special_clean;
+    }
+
+    /*to know if collisions and special events are printed*/
+    bool logEvents() const {
+        return log_events;
+    }
+
+    /*inverse the log_events flag*/
+    void modifyLogEvents() {
+        log_events = !log_events;
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <unsupported/Eigen/CXX11/ThreadPool>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BroadPhase.hpp"
+#include "c3gaPredicates.hpp"
+
+
+/* Narrow phase of the collision detection: run the CGA test on every candidate pair.
+ * The dual spheres of every planet are computed once per step in bulk (5 arrays of coefficients, the test
+ * works on them directly with c3gaPredicates, without any multivector). Each pair is first tested in float,
+ * only the pairs too close to tangency for the float error bound are tested again on the dual spheres in double,
+ * so the results are the ones of the double test (Planet::hasCollided). Then the pairs are split
+ * into chunks which are tested concurrently by a thread pool, each pair writing its own
+ * result, so the results do not depend on the scheduling. */
+class NarrowPhase {
+    private:
+    std::unique_ptr<Eigen::ThreadPool> pool; // null if only one thread is used
+    int nbThreads;
+
+    std::vector<double> dualSpheres; // dual spheres of the planets for the actual step, 5 arrays of one coefficient per planet
+    std::vector<float> errorScales; // error scales of the dual spheres in double, for the float filter
+
+    static const int minPairsPerChunk = 32; // smaller chunks cost more to schedule than to test
+    static const int chunksPerThread = 4; // more chunks than threads, so a slow chunk does not stall the others
+
+    /*call f(begin, end) on chunks of [0, n) of at least minItems items, in parallel*/
+    template<typename F>
+    void parallelFor(size_t n, size_t minItems, F f);
+
+    /*test the pairs [begin, end), skipping the planets which are not loaded*/
+    void testRange(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs,
+                   std::vector<uint8_t>& hits, size_t begin, size_t end) const;
+
+    public:
+    /** @param threads number of threads testing the pairs (including the calling thread),
+     * 0 to use every hardware thread */
+    NarrowPhase(int threads = 0);
+
+    /** Test every candidate pairs
+     * @param planets every planets
+     * @param pairs candidate pairs found by the broad phase
+     * @param hits output vector, hits[p] is 1 if the pair p is colliding and both planets are loaded */
+    void testPairs(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs, std::vector<uint8_t>& hits);
+
+    int getNbThreads() const {
+        return nbThreads;
+    }
+};
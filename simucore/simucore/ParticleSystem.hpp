@@ -0,0 +1,59 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+
+#include "AlignedAllocator.hpp"
+
+
+/* Pool of explosion particles (debris) stored as a structure of arrays. The arrays are
+ * allocated once at the full capacity, the first size() slots hold the living particles
+ * and dead particles are replaced by the last one, so nothing is allocated or shifted
+ * while the simulation runs. New particles are dropped when the pool is full. */
+class ParticleSystem {
+    public:
+    AlignedVector<float> posX, posY, posZ; // position
+    AlignedVector<float> dirX, dirY, dirZ; // where to go
+    AlignedVector<float> sizes; // radius
+
+    static const size_t defaultCapacity = 1 << 16;
+
+    ParticleSystem(size_t capacity = defaultCapacity);
+
+    /*number of living particles*/
+    size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    size_t capacity() const {
+        return sizes.size();
+    }
+
+    glm::vec3 position(size_t i) const {
+        return glm::vec3(posX[i], posY[i], posZ[i]);
+    }
+
+    glm::vec3 direction(size_t i) const {
+        return glm::vec3(dirX[i], dirY[i], dirZ[i]);
+    }
+
+    /*add a particle, return false if the pool is full*/
+    bool add(glm::vec3 position, glm::vec3 direction, float size);
+
+    /*move every particles along their direction and make them smaller (vectorized)*/
+    void advance(float speed, float rate);
+
+    /*remove the particles whose size is smaller or equal to the given one (the order is not kept)*/
+    void removeSmallerThan(float size);
+
+    void clear() {
+        count = 0;
+    }
+
+    private:
+    size_t count = 0;
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <type_traits>
+#include <glm/glm.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <c3ga/Mvec.hpp>
+
+#include "c3gaTools.hpp"
+#include "c3gaPredicates.hpp"
+#include "Random.hpp"
+
+
+struct Planet {
+    public:
+    unsigned int id; // unique identifier in its simulation (see Info::newPlanetId), stays the same when the planet moves in a vector
+    int textureIdx; // texture
+    float size; // radius
+    glm::vec3 position; // x y z
+    float obliquity; // rotation of planet axis
+    float rotationSpeed; // speed of orbital rotation
+    glm::vec3 inclination; // inclination of orbital rotation
+    glm::vec3 direction; // where to go
+    double spawnTime; // time of spawn
+    double durationOfLoad = 0.0; // actual time since spawn
+    static constexpr double loadPeriod = 1.5; // total time of the loading phase
+    bool hasLoaded = false; // to know if the planet is ready to collide
+    float visibility = 1.0; // visual factor
+    float visibilityOp = -0.1; // visual operation
+    unsigned int dirUpdateNb = 0; // update counter for random direction
+    static const int dirUpdateRate = 500; // maximum value for dirUpdateNb
+    static const int ringSize = 5; // rings global size
+    static const int distanceMax = 100; // maximum distance of planets to the center
+    static constexpr float minC = 1.5; // minimum possible size of exploding fragments when collision
+    static constexpr float explosionRate = 1.07; // the rate at which explosion particles are getting smaller
+    static constexpr float explosionSpeed = 0.4; // speed of explosion particles
+    static constexpr float explosionMinSize = 0.3; // minimum possible size of explosion particles
+
+    Planet(unsigned int id, int t, float s, glm::vec3 p, float o, float rs, glm::vec3 i, glm::vec3 d, double ti) :
+        id{id}, textureIdx{t}, size{s}, position{p}, obliquity{o}, rotationSpeed{rs}, inclination{i}, direction{d}, spawnTime{ti} {}
+
+    // ----- COLLISION DETECTION -----
+
+    // return true if the two given spheres (center and radius) are colliding, same result as ((s1 ^ s2) | (s1 ^ s2)) < 0 with the Mvec dual spheres
+    static bool spheresCollide(glm::vec3 position1, float size1, glm::vec3 position2, float size2) {
+        double dualSphere1[5], dualSphere2[5];
+        c3ga::dualSphereCoefficients<double>(position1.x, position1.y, position1.z, double(size1) * double(size1), dualSphere1);
+        c3ga::dualSphereCoefficients<double>(position2.x, position2.y, position2.z, double(size2) * double(size2), dualSphere2);
+        return c3ga::dualSpheresIntersect(dualSphere1, dualSphere2);
+    }
+
+    // return true if the planet has collided with another given planet
+    bool hasCollided(const Planet& other) const {
+        return spheresCollide(position, size, other.position, other.size);
+    }
+
+    // ----- RANDOM SELECTION -----
+    // every selection is drawn from a random stream, usually the one of the planet (its id and the actual step)
+
+    static int selectTextureIdx(RandomStream& random) {
+        int textureIdxMin = 1;
+        int textureIdxMax = 32;
+        return random.uniformInt(textureIdxMin, textureIdxMax);
+    }
+
+    static float selectSize(RandomStream& random) {
+        int sizeMin = int(Planet::minC * 4.0); // THIS VALUE NEEDS TO ALWAYS BE Planet::minC * 4 !!
+        int sizeMax = 20;
+        return random.uniform(sizeMin, sizeMax);
+    }
+
+    static glm::vec3 selectPosition(RandomStream& random) {
+        int positionDistanceMin = 3;
+        int positionDistanceMax = distanceMax;
+        return random.sphericalRand(random.uniform(positionDistanceMin, positionDistanceMax));
+    }
+
+    static float selectObliquity(RandomStream& random) {
+        int obliquityMin = 0;
+        int obliquityMax = 180;
+        return random.uniform(obliquityMin, obliquityMax);
+    }
+
+    static float selectRotationSpeed(RandomStream& random) {
+        int lengthOfDaysMin = -500;
+        int lengthOfDaysMax = 500;
+        float selection = random.uniform(lengthOfDaysMin, lengthOfDaysMax);
+        return 1.0 / (selection == 0.0 ? 24.0 : selection);
+    }
+
+    static glm::vec3 selectInclination(RandomStream& random) {
+        int inclinationMin = 0;
+        int inclinationMax = 20;
+        float inc = random.uniform(inclinationMin, inclinationMax);
+        if(inc == 0.0) return glm::vec3(0, 1, 0);
+        glm::vec4 res = glm::rotate(glm::mat4(1.0), glm::radians(inc), glm::vec3(1, 0, 0))
+                        * glm::vec4(glm::vec3(0, 1, 0), 0.0);
+        return glm::vec3(glm::normalize(res));
+    }
+
+    static int selectExplodingFragments(RandomStream& random) {
+        int nbFragsMin = 4;
+        int nbFragsMax = 6;
+        return random.uniformInt(nbFragsMin, nbFragsMax);
+    }
+
+    static glm::vec3 selectDirection(RandomStream& random) {
+        return glm::normalize(random.sphericalRand(1.0f));
+    }
+};
+
+// planets are returned by value from PlanetSystem, keep the compiler generated copies
+static_assert(std::is_trivially_copyable<Planet>::value, "Planet must stay trivially copyable");
+
+
+
+/** Global order for any functions returning multiple planets data (particulary used for textures Id) :
+ * sun, mercury, venus, earth, mars, jupiter, saturn, uranus, neptune, pluto,
+ * moon, phobos, deimos, calisto, ganymede, europa, io, mimas, enceladus,
+ * tethys, dione, rhea, titan, hyperion, iapetus, ariel, umbriel, titania,
+ * oberon, miranda, triton, nereid, charon,
+ * earthcloud, saturnring, uranusring, skybox, whiteColor
+*/
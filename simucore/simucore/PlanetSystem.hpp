@@ -0,0 +1,88 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "Planet.hpp"
+
+
+/* Every planets of the simulation stored as a structure of arrays: each field has its
+ * own contiguous array, so the update loops only stream over the fields they use.
+ * Hot fields (position, direction, size) are read every step, cold fields are only
+ * read to draw the planets. Planets keep their order, like in a vector. */
+class PlanetSystem {
+    public:
+    // ----- HOT FIELDS -----
+    AlignedVector<float> posX, posY, posZ; // position
+    AlignedVector<float> dirX, dirY, dirZ; // where to go
+    AlignedVector<float> sizes; // radius
+    AlignedVector<unsigned int> ids; // unique identifier (see Planet::id)
+    AlignedVector<unsigned int> dirUpdateNbs; // update counter for random direction
+    AlignedVector<uint8_t> loaded; // to know if the planet is ready to collide
+
+    // ----- COLD FIELDS -----
+    AlignedVector<int> textureIdxs;
+    AlignedVector<float> obliquities;
+    AlignedVector<float> rotationSpeeds;
+    AlignedVector<glm::vec3> inclinations;
+    AlignedVector<double> spawnTimes;
+    AlignedVector<double> durationsOfLoad;
+    AlignedVector<float> visibilities;
+    AlignedVector<float> visibilityOps;
+    AlignedVector<float> prevX, prevY, prevZ; // position before the last step, to draw between two steps
+
+    PlanetSystem() {}
+
+    /*number of planets*/
+    size_t size() const {
+        return ids.size();
+    }
+
+    bool empty() const {
+        return ids.empty();
+    }
+
+    glm::vec3 position(size_t i) const {
+        return glm::vec3(posX[i], posY[i], posZ[i]);
+    }
+
+    glm::vec3 direction(size_t i) const {
+        return glm::vec3(dirX[i], dirY[i], dirZ[i]);
+    }
+
+    /*position between the last two steps, alpha=0 for the previous one and 1 for the actual one*/
+    glm::vec3 interpolatedPosition(size_t i, float alpha) const {
+        return glm::vec3(prevX[i] + (posX[i] - prevX[i]) * alpha, prevY[i] + (posY[i] - prevY[i]) * alpha,
+                         prevZ[i] + (posZ[i] - prevZ[i]) * alpha);
+    }
+
+    /*add a planet at the end*/
+    void add(const Planet& planet);
+
+    /*rebuild the planet at the given index*/
+    Planet get(size_t i) const;
+
+    /*return true if the planets i and j are colliding (CGA test)*/
+    bool hasCollided(size_t i, size_t j) const {
+        return Planet::spheresCollide(position(i), sizes[i], position(j), sizes[j]);
+    }
+
+    /** Remove the marked planets, keeping the order of the others
+     * @param removed flags of the planets to remove, planets after the end of this vector are kept */
+    void remove(const std::vector<uint8_t>& removed);
+
+    /*remove the planets whose size is smaller or equal to the given one*/
+    void removeSmallerThan(float size);
+
+    void reserve(size_t n);
+    void clear();
+
+    private:
+    /*keep the planet j at the index i, in every arrays*/
+    void moveTo(size_t j, size_t i);
+
+    /*shrink every arrays to n planets*/
+    void resize(size_t n);
+};
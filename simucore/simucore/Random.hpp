@@ -0,0 +1,92 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+
+/* Counter-based random numbers: the k-th number of a stream is a hash of
+ * (seed, key, step, k), with no state shared between streams. A random decision
+ * only depends on who takes it (the key, usually the id of a planet) and when
+ * (the simulation step), not on the order of the calls, so runs can be reproduced
+ * from their seed and the update loops can be run in parallel. */
+class Random {
+    private:
+    static uint64_t seed;
+
+    public:
+    /* keys of the streams which are not a planet (planets use their id) */
+    static const uint64_t c3gaKey = uint64_t(1) << 32; // c3ga::randomPoint
+    static const uint64_t explosionKey = uint64_t(2) << 32; // + id of the exploding planet
+
+    static void setSeed(uint64_t s) {
+        seed = s;
+    }
+
+    static uint64_t getSeed() {
+        return seed;
+    }
+
+    /*SplitMix64 finalizer, a bijection on 64 bits with a good avalanche*/
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /*base value of the stream (key, step), see RandomStream*/
+    static uint64_t streamBase(uint64_t key, uint64_t step) {
+        return mix(mix(seed + key * 0x9e3779b97f4a7c15ULL) + step * 0xd1b54a32d192ed03ULL);
+    }
+
+    /*k-th number of the stream starting at the given base*/
+    static uint64_t at(uint64_t base, uint64_t k) {
+        return mix(base + (k + 1) * 0x9e3779b97f4a7c15ULL);
+    }
+
+    /*float in [0, 1) from the 24 high bits of a number*/
+    static float toUnit(uint64_t x) {
+        return float(x >> 40) * (1.0f / 16777216.0f);
+    }
+
+    /** Fill an array with the numbers k = first, first+1, ... of one stream (same values as RandomStream)
+     * @param out output array of n floats in [min, max) */
+    static void fillUniform(float* out, size_t n, uint64_t key, uint64_t step, uint64_t first, float min, float max);
+
+    /** Fill an array with the number k of the streams of several keys, one number per key
+     * @param out output array of n floats in [min, max), out[i] comes from the stream (keys[i], step) */
+    static void fillUniform(float* out, const unsigned int* keys, size_t n, uint64_t step, uint64_t k, float min, float max);
+};
+
+
+/* Sequence of random numbers of one (key, step), drawn in order */
+class RandomStream {
+    private:
+    uint64_t base;
+    uint64_t counter = 0;
+
+    public:
+    RandomStream(uint64_t key, uint64_t step) : base{Random::streamBase(key, step)} {}
+
+    uint64_t next() {
+        return Random::at(base, counter++);
+    }
+
+    /*float in [0, 1)*/
+    float uniform() {
+        return Random::toUnit(next());
+    }
+
+    /*float in [min, max)*/
+    float uniform(float min, float max) {
+        return min + (max - min) * uniform();
+    }
+
+    /*int in [min, max]*/
+    int uniformInt(int min, int max) {
+        return min + int(next() % uint64_t(max - min + 1));
+    }
+
+    /*random point on the sphere of the given radius (like glm::sphericalRand)*/
+    glm::vec3 sphericalRand(float radius);
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Planet.hpp"
+#include "PlanetSystem.hpp"
+#include "ParticleSystem.hpp"
+#include "Info.hpp"
+#include "BroadPhase.hpp"
+#include "NarrowPhase.hpp"
+
+
+/**Create one planet with random parameters, drawn from the random stream of its id and the actual step
+ * @param info the simulation, gives the id of the planet, the step and the time */
+Planet createPlanet(Info* info);
+
+/**Create one planet of the given size and position, the other parameters are random
+ * @param textureIdx texture of the planet, or -1 to select a random one */
+Planet createPlanet(Info* info, int size, glm::vec3 position, int textureIdx = -1);
+
+/**Create the initial planets (at the actual step, 0 for a new simulation)*/
+PlanetSystem createAllPlanets(int nb, Info* info);
+
+/**Add the particles of a new explosion
+ * @param random stream of the exploding planet, used to select the number and directions of the particles */
+void addExplosion(ParticleSystem* explosions, int size, glm::vec3 position, RandomStream& random);
+
+/* Working arrays of updateEverything, kept from one step to the next (like the dual spheres of NarrowPhase),
+ * so a step does not allocate once they have grown to the number of planets */
+struct UpdateBuffers {
+    AlignedVector<float> bounce; // -1 if the planet bounces on the hitbox, 1 otherwise
+    std::vector<unsigned int> turning; // planets changing of direction
+    std::vector<unsigned int> keys; // ids of the turning planets
+    std::vector<float> z, a; // random numbers of the new directions
+    std::vector<CandidatePair> pairs; // candidate pairs of the broad phase
+    std::vector<uint8_t> hits; // results of the narrow phase
+    std::vector<uint8_t> collided; // 1 if the planet collided during this step, these planets are removed
+    std::vector<int> collidedList; // indexes of the collided planets
+};
+
+/** Update every planets parameters (one step of the simulation)
+ * @param planets every planets, stored as a structure of arrays
+ * @param explosions every explosion particles
+ * @param info Info structure containing various data, including time
+ * @param broadPhase broad phase used to find the pairs of planets to test for collision
+ * @param narrowPhase narrow phase testing the pairs found by the broad phase (in parallel)
+ * @param buffers working arrays, the same ones for every step
+ * @return the number of collisions detected during this step */
+int updateEverything(PlanetSystem* planets, ParticleSystem* explosions, Info* info, BroadPhase* broadPhase, NarrowPhase* narrowPhase,
+                     UpdateBuffers* buffers);
+
+/**Update the visibility (brightness) of planets when they are not loaded*/
+void updateVisibility(PlanetSystem* planets, Info info);
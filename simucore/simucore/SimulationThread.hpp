@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Simulation.hpp"
+#include "DynamicTree.hpp"
+#include "Snapshot.hpp"
+#include "TripleBuffer.hpp"
+
+
+/* Runs the simulation on its own thread, at a fixed rate (see FixedStepClock), and
+ * publishes a Snapshot after the steps of each loop. The render thread draws the last
+ * snapshot without any lock, so a slow step never stalls the display, and it sends
+ * its inputs with the request and set functions. */
+class SimulationThread {
+    private:
+    SteadyClock clock; // monotonic, drives the steps (the pauses are a time scale of 0)
+    Info info{&clock}; // own copy, only used by the simulation thread
+    PlanetSystem planets;
+    ParticleSystem explosions; // explosion particles
+    DynamicTree broadPhase; // find the pairs of planets that may collide
+    NarrowPhase narrowPhase; // test these pairs on every hardware thread
+    UpdateBuffers updateBuffers; // working arrays of the steps
+    FixedStepClock stepClock; // run the simulation steps at a fixed rate
+    TripleBuffer<Snapshot> snapshots;
+
+    std::atomic<double> timeScale{1.0}; // simulated time per second, 0 if paused
+    std::atomic<bool> spawnRequest{false};
+    std::atomic<bool> cleanRequest{false};
+    std::atomic<bool> running{false};
+    std::thread thread;
+
+    /*main loop of the simulation thread*/
+    void run();
+
+    /*copy the actual state in a snapshot and publish it*/
+    void publish();
+
+    public:
+    /** @param nbPlanets initial number of planets */
+    SimulationThread(int nbPlanets);
+    ~SimulationThread();
+
+    void start();
+    void stop();
+
+    /*set the simulated time per second (see Info::getTimeScale), 0 to pause*/
+    void setTimeScale(double scale) {
+        timeScale = scale;
+    }
+
+    /*spawn a new planet at the next step*/
+    void requestSpawn() {
+        spawnRequest = true;
+    }
+
+    /*delete all small planets at the next step*/
+    void requestClean() {
+        cleanRequest = true;
+    }
+
+    /*time of the clock of the simulation, the one of Snapshot::time (callable from any thread)*/
+    double now() const {
+        return clock.now();
+    }
+
+    /*last published snapshot, render thread only (valid until the next call)*/
+    const Snapshot& latest() {
+        snapshots.update();
+        return snapshots.readBuffer();
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "PlanetSystem.hpp"
+#include "ParticleSystem.hpp"
+
+
+/* What is needed to draw the simulation after a step: copied by the simulation thread,
+ * then only read by the render thread. The arrays keep their memory between two steps. */
+struct Snapshot {
+    // ----- PLANETS -----
+    std::vector<glm::vec3> previous; // position before the last step
+    std::vector<glm::vec3> positions;
+    std::vector<float> sizes;
+    std::vector<float> visibilities;
+    std::vector<int> textureIdxs;
+    std::vector<float> obliquities;
+    std::vector<float> rotationSpeeds;
+    std::vector<glm::vec3> inclinations;
+
+    // ----- EXPLOSIONS -----
+    // one contiguous (x, y, z, size) array per state, every particle uses the white texture
+    std::vector<glm::vec4> particlePrevious; // before the last step
+    std::vector<glm::vec4> particles;
+
+    // ----- TIME -----
+    uint64_t step = 0; // number of steps done
+    double time = 0.0; // time of the clock of the simulation (SimulationThread::now) when the snapshot was taken
+    float alpha = 0.0; // fraction of the next step already elapsed at that time
+    double stepInterval = 0.0; // time of the clock between two steps, 0 if paused
+
+    /*copy the state of the simulation*/
+    void capture(const PlanetSystem& planets, const ParticleSystem& explosions);
+
+    /*fraction of the next step elapsed at the given time, to draw between the last two steps*/
+    float alphaAt(double now) const {
+        if(stepInterval <= 0.0) return alpha;
+        double a = alpha + (now - time) / stepInterval;
+        return float(a < 0.0 ? 0.0 : (a > 1.0 ? 1.0 : a));
+    }
+
+    size_t nbPlanets() const {
+        return positions.size();
+    }
+
+    size_t nbExplosions() const {
+        return particles.size();
+    }
+};
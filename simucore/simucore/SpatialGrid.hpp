@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BroadPhase.hpp"
+
+
+/* Hashed uniform grid: planets are stored in the cell containing their center.
+ * Cells are as large as the biggest planet diameter, so two planets can only
+ * collide if they are in the same cell or in neighbouring cells. Cells are hashed,
+ * so there is no limit on the coordinates of the planets. */
+class SpatialGrid : public BroadPhase {
+    private:
+    float cellSize = 1.0; // size of a cell, computed from the largest planet
+    std::vector<std::pair<uint64_t, int>> entries; // (cell key, planet index), sorted by key
+    std::unordered_map<uint64_t, std::pair<int, int>> cells; // cell key -> range [begin, end) in entries
+
+    /*key of the cell of the given integer coordinates*/
+    static uint64_t cellKey(int64_t x, int64_t y, int64_t z);
+
+    /*integer coordinate of a position along one axis*/
+    int64_t cellCoord(float p) const;
+
+    public:
+    SpatialGrid() {}
+
+    void findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) override;
+
+    float getCellSize() const {
+        return cellSize;
+    }
+};
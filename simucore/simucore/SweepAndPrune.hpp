@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "BroadPhase.hpp"
+
+
+/* Incremental sweep and prune: the bounds of every planet are kept sorted along each
+ * axis from one step to the next. Planets only move a little every step, so the lists
+ * are repaired with an insertion sort, and only the swaps between a lower and an upper
+ * bound can start or stop an overlap. The overlapping pairs are kept between steps. */
+class SweepAndPrune : public BroadPhase {
+    private:
+    /* bounding box of a planet */
+    struct Proxy {
+        unsigned int id; // id of the planet
+        int index; // index of the planet in the vector, updated every step
+        float lower[3]; // lower corner of the box
+        float upper[3]; // upper corner of the box
+        unsigned int lastStep; // last step where the planet was found
+        bool alive; // false if the slot is free
+    };
+
+    /* lower or upper bound of a box along one axis */
+    struct Endpoint {
+        float value;
+        int proxy; // index of the proxy
+        bool isUpper;
+    };
+
+    std::vector<Proxy> proxies; // freed slots are recycled
+    std::vector<int> freeProxies; // indexes of the freed slots
+    std::unordered_map<unsigned int, int> proxyOfId; // planet id -> proxy index
+    std::vector<Endpoint> endpoints[3]; // sorted bounds along x, y and z
+    std::unordered_set<uint64_t> overlaps; // pairs of planet ids whose boxes overlap
+    std::vector<std::pair<unsigned int, unsigned int>> addedPairs; // new overlaps of the last step
+    std::vector<std::pair<unsigned int, unsigned int>> removedPairs; // lost overlaps of the last step
+    unsigned int step = 0; // number of calls to findPairs
+
+    /*key of a pair of planet ids*/
+    static uint64_t pairKey(unsigned int a, unsigned int b);
+
+    /*set the box of a proxy around the planet i*/
+    static void setBounds(Proxy& proxy, const PlanetSystem& planets, int i);
+
+    /*true if the two boxes overlap on all axes*/
+    bool overlap(int a, int b) const;
+
+    /*add or remove the pair of proxies from the overlapping pairs, depending on their boxes*/
+    void updatePair(int a, int b);
+
+    /*add a planet to the endpoint lists (placed by the next sort)*/
+    void insertProxy(const PlanetSystem& planets, int index);
+
+    /*remove every planets not found during this step*/
+    void removeLostProxies();
+
+    /*repair the order of the endpoints of one axis*/
+    void sortAxis(int axis);
+
+    public:
+    SweepAndPrune() {}
+
+    void findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) override;
+
+    /*pairs of planet ids which started to overlap during the last step*/
+    const std::vector<std::pair<unsigned int, unsigned int>>& getAddedPairs() const {
+        return addedPairs;
+    }
+
+    /*pairs of planet ids which stopped to overlap during the last step (or were removed)*/
+    const std::vector<std::pair<unsigned int, unsigned int>>& getRemovedPairs() const {
+        return removedPairs;
+    }
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+
+
+/* Three copies of a value shared by one writer thread and one reader thread, without locks.
+ * The writer fills its own copy and publishes it, the reader takes the last published copy.
+ * Neither of them ever waits for the other, and a copy is never read while being written. */
+template<typename T>
+class TripleBuffer {
+    private:
+    static const int freshBit = 4; // set in middle when it holds a copy the reader has not taken yet
+    static const int indexMask = 3;
+
+    T buffers[3];
+    int back = 0; // copy of the writer
+    int front = 1; // copy of the reader
+    std::atomic<int> middle{2}; // last published copy (and freshBit)
+
+    public:
+    TripleBuffer() {}
+
+    /*copy to fill, writer only*/
+    T& writeBuffer() {
+        return buffers[back];
+    }
+
+    /*publish the filled copy and take an old one to fill next, writer only*/
+    void publish() {
+        back = middle.exchange(back | freshBit) & indexMask;
+    }
+
+    /*take the last published copy if there is a new one, reader only
+     * @return true if the read copy changed */
+    bool update() {
+        if(!(middle.load() & freshBit)) return false;
+        front = middle.exchange(front) & indexMask;
+        return true;
+    }
+
+    /*copy to read, reader only*/
+    const T& readBuffer() const {
+        return buffers[front];
+    }
+};
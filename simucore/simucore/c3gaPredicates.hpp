@@ -0,0 +1,326 @@
+// c3gaPredicates.hpp
+
+/// \file c3gaPredicates.hpp
+/// \brief allocation-free intersection predicates of conformal geometric algebra of R^3, computed directly on the
+/// coefficients of the objects instead of going through c3ga::Mvec. A grade 1 object (point, dual sphere, dual plane)
+/// is given by its 5 coefficients in the order of the c3ga basis (e0, e1, e2, e3, ei), a dual line by its 10 grade 2
+/// coefficients (e01, e02, e03, e0i, e12, e13, e1i, e23, e2i, e3i).
+/// The products go through the grade-typed k-vectors of the c3ga lib (KVector.hpp), so they call the same explicit
+/// functions as Mvec (OuterExplicit.hpp and InnerExplicit.hpp) and every predicate gives exactly the same result as its
+/// Mvec version, rounding included.
+
+
+// Anti-doublon
+#ifndef C3GA_PREDICATES_HPP__
+#define C3GA_PREDICATES_HPP__
+#pragma once
+
+// External Includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Internal Includes
+#include <c3ga/Mvec.hpp>
+#include <c3ga/KVector.hpp>
+#include <c3ga/Batch.hpp>
+#include <c3ga/BatchDispatch.hpp>
+
+
+/// \namespace grouping the multivectors object
+namespace c3ga{
+
+
+    // ----- COEFFICIENTS -----
+
+    /// \brief coefficients of a point, same values as c3ga::point
+    /// \param x point component related to e1
+    /// \param y point component related to e2
+    /// \param z point component related to e3
+    /// \param point output, the 5 coefficients of p = e0 + x e1 + y e2 + z e3 + 0.5 || (x e1 + y e2 + z e3) ||^2 einf
+    template<typename T>
+    inline void pointCoefficients(const T &x, const T &y, const T &z, T *point){
+        point[0] = 1.0;
+        point[1] = x;
+        point[2] = y;
+        point[3] = z;
+        point[4] = 0.5 * (x*x + y*y + z*z);
+    }
+
+    /// \brief coefficients of a dual sphere, same values as c3ga::dualSphere
+    /// \param centerX dual sphere center component related to e1
+    /// \param centerY dual sphere center component related to e2
+    /// \param centerZ dual sphere center component related to e3
+    /// \param radius of the sphere (as in c3ga::dualSphere, the squared radius gives a sphere of this radius)
+    /// \param dualSphere output, the 5 coefficients of s = center - 0.5 radius ei
+    template<typename T>
+    inline void dualSphereCoefficients(const T &centerX, const T &centerY, const T &centerZ, const T &radius, T *dualSphere){
+        pointCoefficients(centerX, centerY, centerZ, dualSphere);
+        dualSphere[4] -= 0.5*radius;
+    }
+
+    /// \brief coefficients of a dual plane
+    /// \param normalX, normalY, normalZ unit normal of the plane
+    /// \param distance signed distance of the plane to the origin, along its normal
+    /// \param dualPlane output, the 5 coefficients of pi = normal + distance ei
+    template<typename T>
+    inline void dualPlaneCoefficients(const T &normalX, const T &normalY, const T &normalZ, const T &distance, T *dualPlane){
+        dualPlane[0] = 0.0;
+        dualPlane[1] = normalX;
+        dualPlane[2] = normalY;
+        dualPlane[3] = normalZ;
+        dualPlane[4] = distance;
+    }
+
+    /// \brief copy the grade 1 coefficients of a multivector (the other grades are ignored)
+    /// \param mv multivector, usually a point, a dual sphere or a dual plane
+    /// \param vector output, the 5 coefficients
+    template<typename T>
+    inline void vectorCoefficients(const c3ga::Mvec<T> &mv, T *vector){
+        vector[0] = mv[c3ga::E0];
+        vector[1] = mv[c3ga::E1];
+        vector[2] = mv[c3ga::E2];
+        vector[3] = mv[c3ga::E3];
+        vector[4] = mv[c3ga::Ei];
+    }
+
+    /// \brief copy the grade 2 coefficients of a multivector (the other grades are ignored)
+    /// \param mv multivector, usually a dual line
+    /// \param bivector output, the 10 coefficients
+    template<typename T>
+    inline void bivectorCoefficients(const c3ga::Mvec<T> &mv, T *bivector){
+        bivector[0] = mv[c3ga::E01]; bivector[1] = mv[c3ga::E02]; bivector[2] = mv[c3ga::E03]; bivector[3] = mv[c3ga::E0i];
+        bivector[4] = mv[c3ga::E12]; bivector[5] = mv[c3ga::E13]; bivector[6] = mv[c3ga::E1i];
+        bivector[7] = mv[c3ga::E23]; bivector[8] = mv[c3ga::E2i];
+        bivector[9] = mv[c3ga::E3i];
+    }
+
+
+    // ----- SQUARED MEETS -----
+
+    /// \brief compute (a ^ b) | (a ^ b) for two grade 1 objects, same operations as Mvec (outer_1_1 then inner_2_2)
+    /// \param a the 5 coefficients of the first object
+    /// \param b the 5 coefficients of the second object
+    /// \return the scalar (a.b)^2 - (a.a)(b.b), negative if the meet of the two objects is a real circle
+    template<typename T>
+    inline T squaredOuterVectorVector(const T *a, const T *b){
+        const c3ga::Vec2<T> meet = c3ga::Vec1<T>(a) ^ c3ga::Vec1<T>(b);
+        return meet | meet;
+    }
+
+    /// \brief compute (a ^ B) | (a ^ B) for a grade 1 object and a grade 2 object, same operations as Mvec (outer_1_2 then inner_3_3)
+    /// \param a the 5 coefficients of the grade 1 object
+    /// \param B the 10 coefficients of the grade 2 object
+    /// \return the scalar square of the dual point pair, negative if the point pair is real
+    template<typename T>
+    inline T squaredOuterVectorBivector(const T *a, const T *B){
+        const c3ga::Vec3<T> meet = c3ga::Vec1<T>(a) ^ c3ga::Vec2<T>(B);
+        return meet | meet;
+    }
+
+
+    // ----- PREDICATES -----
+
+    /// \brief test if two dual spheres intersect, same result as ((s1 ^ s2) | (s1 ^ s2)) < 0 with Mvec
+    /// \param dualSphere1 the 5 coefficients of the first dual sphere
+    /// \param dualSphere2 the 5 coefficients of the second dual sphere
+    /// \return true if the intersection of the spheres is a real circle (tangent spheres do not intersect)
+    template<typename T>
+    inline bool dualSpheresIntersect(const T *dualSphere1, const T *dualSphere2){
+        return squaredOuterVectorVector(dualSphere1, dualSphere2) < 0.0;
+    }
+
+    /// \brief test if a dual sphere and a dual plane intersect, same result as ((s ^ pi) | (s ^ pi)) < 0 with Mvec
+    /// \param dualSphere the 5 coefficients of the dual sphere
+    /// \param dualPlane the 5 coefficients of the dual plane
+    /// \return true if the intersection of the sphere and the plane is a real circle
+    template<typename T>
+    inline bool dualSphereIntersectsDualPlane(const T *dualSphere, const T *dualPlane){
+        return squaredOuterVectorVector(dualSphere, dualPlane) < 0.0;
+    }
+
+    /// \brief test if a dual sphere and a dual line intersect, same result as ((s ^ l) | (s ^ l)) < 0 with Mvec
+    /// \param dualSphere the 5 coefficients of the dual sphere
+    /// \param dualLine the 10 coefficients of the dual line (for instance the dual of p1 ^ p2 ^ ei)
+    /// \return true if the intersection of the sphere and the line is a real point pair
+    template<typename T>
+    inline bool dualSphereIntersectsDualLine(const T *dualSphere, const T *dualLine){
+        return squaredOuterVectorBivector(dualSphere, dualLine) < 0.0;
+    }
+
+    /// \brief test if a point is inside a dual sphere, same result as (p | s) > 0 with Mvec
+    /// \param point the 5 coefficients of the point (with a positive e0 coefficient, as built by c3ga::point)
+    /// \param dualSphere the 5 coefficients of the dual sphere (with a positive e0 coefficient, as built by c3ga::dualSphere)
+    /// \return true if the point is strictly inside the sphere
+    template<typename T>
+    inline bool pointInDualSphere(const T *point, const T *dualSphere){
+        return T(c3ga::Vec1<T>(point) | c3ga::Vec1<T>(dualSphere)) > 0.0;
+    }
+
+
+    // ----- BATCHED PREDICATES -----
+
+    /// \brief test a batch of pairs of dual spheres (or dual spheres and dual planes)
+    /// \param vectors the grade 1 objects, stored one after another (5 coefficients each)
+    /// \param pairs indexes of the two objects of each pair in vectors
+    /// \param nbPairs number of pairs
+    /// \param result output, result[p] is 1 if the objects of the pair p intersect (see dualSpheresIntersect), else 0
+    template<typename T>
+    inline void dualSpheresIntersect(const T *vectors, const std::pair<int,int> *pairs, const std::size_t nbPairs, uint8_t *result){
+        for(std::size_t p=0; p<nbPairs; ++p)
+            result[p] = dualSpheresIntersect(vectors + 5*pairs[p].first, vectors + 5*pairs[p].second);
+    }
+
+    /// \brief test a batch of points against a dual sphere
+    /// \param points the points, stored one after another (5 coefficients each)
+    /// \param nbPoints number of points
+    /// \param dualSphere the 5 coefficients of the dual sphere
+    /// \param result output, result[n] is 1 if the point n is inside the sphere (see pointInDualSphere), else 0
+    template<typename T>
+    inline void pointsInDualSphere(const T *points, const std::size_t nbPoints, const T *dualSphere, uint8_t *result){
+        for(std::size_t n=0; n<nbPoints; ++n)
+            result[n] = pointInDualSphere(points + 5*n, dualSphere);
+    }
+
+
+    // ----- STRUCTURES OF ARRAYS -----
+    // n objects are stored as in c3ga::batch: one array of n coefficients per basis blade, one after another
+
+    namespace batch{
+
+    /// \brief dual spheres of n spheres
+    /// \param centerX, centerY, centerZ the n centers
+    /// \param radius the n radii (not squared)
+    /// \param n number of spheres
+    /// \param dualSpheres output, 5 arrays of n coefficients, same values as dualSphereCoefficients(centerX[j], centerY[j], centerZ[j], radius[j]*radius[j]) with the type T
+    template<typename T, typename U>
+    inline void dualSpheres(const U* __restrict centerX, const U* __restrict centerY, const U* __restrict centerZ, const U* __restrict radius,
+                            const std::size_t n, T* __restrict dualSpheres){
+        C3GA_BATCH_LOOP
+        for(std::size_t j=0; j<n; ++j){
+            T dualSphere[5];
+            dualSphereCoefficients<T>(centerX[j], centerY[j], centerZ[j], T(radius[j]) * T(radius[j]), dualSphere);
+            for(unsigned int i=0; i<5; ++i)
+                dualSpheres[i*n + j] = dualSphere[i];
+        }
+    }
+
+    /// \brief test a batch of pairs of dual spheres (or dual spheres and dual planes), same results as dualSpheresIntersect
+    /// \param vectors the grade 1 objects, 5 arrays of nbVectors coefficients
+    /// \param nbVectors number of objects
+    /// \param pairs indexes of the two objects of each pair in vectors
+    /// \param nbPairs number of pairs
+    /// \param result output, result[p] is 1 if the objects of the pair p intersect, else 0
+    template<typename T>
+    inline void dualSpheresIntersect(const T* __restrict vectors, const std::size_t nbVectors,
+                                     const std::pair<int,int>* __restrict pairs, const std::size_t nbPairs, uint8_t* __restrict result){
+        const std::size_t blockSize = 64;
+        T squaredMeets[blockSize];
+        for(std::size_t block=0; block<nbPairs; block+=blockSize){
+            const std::size_t n = std::min(nbPairs - block, blockSize);
+            for(std::size_t p=0; p<n; ++p){ // vectorized, the comparison is apart (a mask of doubles to bytes is not)
+                const c3ga::Vec2<T> meet = c3ga::batch::load<T, 1>(vectors, nbVectors, pairs[block + p].first)
+                                         ^ c3ga::batch::load<T, 1>(vectors, nbVectors, pairs[block + p].second);
+                squaredMeets[p] = meet | meet;
+            }
+            for(std::size_t p=0; p<n; ++p)
+                result[block + p] = squaredMeets[p] < 0.0;
+        }
+    }
+
+
+    // ----- FILTERED PREDICATES -----
+    // For two dual spheres s1 and s2 of centers c1, c2 and squared radii R1, R2, (s1 ^ s2) | (s1 ^ s2) = (s1.s2)^2 - (s1.s1)(s2.s2)
+    // with s1.s2 = 0.5 (R1 + R2 - D), D = ||c2 - c1||^2, and si.si = Ri: the squared meet is V = 0.25 (R1 + R2 - D)^2 - R1 R2.
+    // This form only depends on the distance between the centers, it is evaluated in float, its sign is the one of the double
+    // version (dualSpheresIntersect of the dual spheres computed in double from the same float centers and radii, as
+    // Planet::spheresCollide) whenever |V in float| > filterBound M + e1 e2, M = 0.25 (R1 + R2 + D)^2 + R1 R2, ei = dualSphereErrorScale(si).
+    // Error bounds, u being the unit roundoff (2^-24 in float, 2^-53 in double) and g(k) = k u / (1 - k u):
+    // - in float, D is computed with an error of at most g(5) D (a subtraction, a product and 2 additions), R1 + R2 - D within
+    //   g(7) (R1 + R2 + D), and V within g(18) M, plus at most 2 u M for the underflows (see the ranges below), so g(20) M;
+    // - in double, the coefficient ei of each dual sphere is within g(3) H, H = 0.5 (||c||^2 + R) (the squares of floats are
+    //   exact in double), every product of the squared meet has at most two ei factors and goes through 12 roundings (a product
+    //   and a subtraction for the meet, a product and 9 additions for the inner product), so V in double is within g(18) P,
+    //   P being the sum of the absolute values of these products with H instead of |ei|: P <= 2 N1 N2, Ni = 1 + ||ci||^2 + Hi^2;
+    // with filterBound = 2^-19 > g(20) and ei = 2^-23 Ni (2^-46 > 2 g(18) in double), the margins covering the roundings of the
+    // bounds themselves, a float result beyond the bound has the sign of the exact value, so of the double one.
+    // The radii must be of magnitude in [2^-30, 2^18] and the centers of magnitude at most 2^18 (no overflow, and every
+    // underflow is below u M), the error scale of the other spheres is infinite, so they always fall back to double.
+
+    constexpr float filterBound = 1.0f / float(1 << 19); /*!< relative bound of the sign filter of the squared meets in float */
+
+    /// \brief error scales of n dual spheres for dualSpheresIntersectFiltered, their product bounds the rounding error of
+    /// dualSpheresIntersect in double
+    /// \param centerX, centerY, centerZ the n centers
+    /// \param radius the n radii (not squared)
+    /// \param n number of spheres
+    /// \param errorScales output, 2^-23 (1 + ||c||^2 + (0.5 (||c||^2 + r^2))^2) for each sphere, or infinity if its center or
+    /// its radius is out of the range of the filter
+    inline void dualSphereErrorScales(const float* __restrict centerX, const float* __restrict centerY, const float* __restrict centerZ,
+                                      const float* __restrict radius, const std::size_t n, float* __restrict errorScales){
+        C3GA_BATCH_LOOP
+        for(std::size_t j=0; j<n; ++j){
+            const float squaredNorm = centerX[j]*centerX[j] + centerY[j]*centerY[j] + centerZ[j]*centerZ[j];
+            const float magnitude = 0.5f * (squaredNorm + radius[j]*radius[j]);
+            const float maxCenter = std::max(std::fabs(centerX[j]), std::max(std::fabs(centerY[j]), std::fabs(centerZ[j])));
+            const bool inRange = maxCenter <= 0x1p18f && std::fabs(radius[j]) >= 0x1p-30f && std::fabs(radius[j]) <= 0x1p18f; // false with NaN
+            errorScales[j] = inRange ? 0x1p-23f * (1.0f + squaredNorm + magnitude*magnitude) : INFINITY;
+        }
+    }
+
+    /// \brief test a batch of pairs of spheres in float, same results as dualSpheresIntersect in double: the pairs whose sign is
+    /// not certain in float are tested again in double
+    /// \param centerX, centerY, centerZ the nbVectors centers
+    /// \param radius the nbVectors radii (not squared)
+    /// \param errorScales the nbVectors error scales (see dualSphereErrorScales)
+    /// \param exactVectors the dual spheres in double, 5 arrays of nbVectors coefficients (see dualSpheres)
+    /// \param nbVectors number of spheres
+    /// \param pairs indexes of the two spheres of each pair
+    /// \param nbPairs number of pairs
+    /// \param result output, result[p] is 1 if the spheres of the pair p intersect, else 0
+    /// \return the number of pairs tested in double
+    inline std::size_t dualSpheresIntersectFiltered(const float* __restrict centerX, const float* __restrict centerY, const float* __restrict centerZ,
+                                                    const float* __restrict radius, const float* __restrict errorScales, const double* __restrict exactVectors,
+                                                    const std::size_t nbVectors, const std::pair<int,int>* __restrict pairs, const std::size_t nbPairs,
+                                                    uint8_t* __restrict result){
+        const std::size_t blockSize = 64;
+        uint8_t uncertain[blockSize];
+        std::size_t nbExact = 0;
+        for(std::size_t block=0; block<nbPairs; block+=blockSize){
+            const std::size_t n = std::min(nbPairs - block, blockSize);
+            unsigned int nbUncertain = 0;
+            for(std::size_t p=0; p<n; ++p){ // vectorized
+                const int first = pairs[block + p].first, second = pairs[block + p].second;
+                const float dx = centerX[second] - centerX[first], dy = centerY[second] - centerY[first], dz = centerZ[second] - centerZ[first];
+                const float squaredDistance = dx*dx + dy*dy + dz*dz;
+                const float squaredRadius1 = radius[first]*radius[first], squaredRadius2 = radius[second]*radius[second];
+                const float dotProduct = (squaredRadius1 + squaredRadius2) - squaredDistance; // 2 s1.s2
+                const float dotMagnitude = (squaredRadius1 + squaredRadius2) + squaredDistance;
+                const float squaredMeet = 0.25f*(dotProduct*dotProduct) - squaredRadius1*squaredRadius2;
+                const float bound = filterBound * (0.25f*(dotMagnitude*dotMagnitude) + squaredRadius1*squaredRadius2) + errorScales[first]*errorScales[second];
+                result[block + p] = squaredMeet < 0.0f;
+                uncertain[p] = !(std::fabs(squaredMeet) > bound); // true with an infinite bound
+                nbUncertain += uncertain[p];
+            }
+            if(nbUncertain == 0)
+                continue;
+            for(std::size_t p=0; p<n; ++p){ // the pairs too close to tangency, tested again in double
+                if(!uncertain[p])
+                    continue;
+                const c3ga::Vec2<double> meet = c3ga::batch::load<double, 1>(exactVectors, nbVectors, pairs[block + p].first)
+                                              ^ c3ga::batch::load<double, 1>(exactVectors, nbVectors, pairs[block + p].second);
+                result[block + p] = double(meet | meet) < 0.0;
+            }
+            nbExact += nbUncertain;
+        }
+        return nbExact;
+    }
+
+    } // namespace batch
+
+
+} // namespace
+
+#endif // projection_inclusion_guard
@@ -14,13 +14,14 @@
 #pragma once
 
 // External Includes
-#include <random>
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <limits>
 
 // Internal Includes
 #include <c3ga/Mvec.hpp>
+#include "Random.hpp"
 
 
 /// \namespace grouping the multivectors object
@@ -55,27 +56,42 @@ namespace c3ga{
     }
 
 
-    static std::default_random_engine generator;
+    /// \brief number of random points already built, each point uses its own random stream
+    inline std::atomic<uint64_t>& randomPointCounter(){
+        static std::atomic<uint64_t> counter(0);
+        return counter;
+    }
 
     inline void setRandomSeed(unsigned int seed){
-        generator.seed(seed);
+        Random::setSeed(seed);
+        randomPointCounter() = 0;
     }
 
     inline void setRandomSeed(){
-        generator.seed(std::chrono::system_clock::now().time_since_epoch().count());
+        setRandomSeed(std::chrono::system_clock::now().time_since_epoch().count());
+    }
+
+    /// \brief build a random point with Euclidean coordinates ranging in [-1,1]
+    /// \param random counter-based random stream the coordinates are drawn from
+    /// \return a multivector corresponding to a point p = e0 + v1 e1 + v2 e2 + v3 e3 + 0.5 || vec ||^2 einf
+    template<typename T>
+    c3ga::Mvec<T> randomPoint(RandomStream &random){
+        T x = random.uniform(-1.0, 1.0);
+        T y = random.uniform(-1.0, 1.0);
+        T z = random.uniform(-1.0, 1.0);
+        return point(x, y, z);
     }
 
     /// \brief build a random point with Euclidean coordinates ranging in [-1,1]
-    /// \param seed optional random seem
     /// \return a multivector corresponding to a point p = e0 + v1 e1 + v2 e2 + v3 e3 + 0.5 || vec ||^2 einf
     template<typename T>
     c3ga::Mvec<T> randomPoint(){
 
-		// uniform distribution over [-1,1]
-		std::uniform_real_distribution<T> uniformRealDistribution(-1.0,1.0);
+		// the n-th point uses the n-th stream, so calls from several threads do not share any state
+		RandomStream random(Random::c3gaKey, randomPointCounter()++);
 
 		// build the point
-        return point(uniformRealDistribution(generator), uniformRealDistribution(generator), uniformRealDistribution(generator));
+        return randomPoint<T>(random);
     }
 
 
@@ -125,8 +141,9 @@ namespace c3ga{
     template<typename T>
     void extractPairPoint(const c3ga::Mvec<T> &pairPoint, c3ga::Mvec<T> &pt1, c3ga::Mvec<T> &pt2){
         c3ga::Mvec<T> denominator = - c3ga::ei<double>() | pairPoint;
-        pt1 = (pairPoint + sqrt(fabs(pairPoint | pairPoint)) ) / denominator;
-        pt2 = (pairPoint - sqrt(fabs(pairPoint | pairPoint)) ) / denominator;
+        T innerSqrt = sqrt(fabs(pairPoint.productScalar(pairPoint))); // scalar part only, same value as pairPoint | pairPoint
+        pt1 = (pairPoint + innerSqrt) / denominator;
+        pt2 = (pairPoint - innerSqrt) / denominator;
 
         // remove numerical error (nearly zero remaining parts)
         pt1.roundZero();
@@ -196,12 +213,12 @@ namespace c3ga{
         if(grades_.size() == 1){
 
             // numerical stability: scale the multivector so that the average of the coeff is 1
-            auto blade = mv.findGrade(grades_[0])->vec;
+            Eigen::Matrix<T, Eigen::Dynamic, 1> blade = mv.kvec(grades_[0]);
             mv /= blade.array().abs().sum() / blade.size();
             //return std::to_string((double)blade.array().abs().sum()/ blade.size());
 
             // extract properties
-            T square = (mv | mv);
+            T square = mv.productScalar(mv); // the blade is homogeneous, same value as mv | mv
             c3ga::Mvec<T> ei_outer_mv(c3ga::ei<T>() ^ mv);
             bool squareToZero = (fabs(square) <= 1.0e3*epsilon);
             bool roundObject  = !(fabs(ei_outer_mv.quadraticNorm()) < epsilon);
@@ -415,7 +432,7 @@ namespace c3ga{
         T square = (mv | mv);
         c3ga::Mvec<T> ei_outer_mv(c3ga::ei<T>() ^ mv);
         //c3ga::Mvec<T> ei_inner_mv(c3ga::ei<T>() | mv);  // inner product
-        c3ga::Mvec<T> ei_inner_mv( (c3ga::ei<T>() * mv).grade(1-mv.grade()));  // left contractin
+        c3ga::Mvec<T> ei_inner_mv( c3ga::ei<T>().productGrade(1-mv.grade(), mv));  // left contractin
 
         bool squareToZero = (fabs(square) <= epsilon);
         bool ei_outer_mv_toZero = (ei_outer_mv.norm() < epsilon);
@@ -540,7 +557,7 @@ namespace c3ga{
     std::vector<c3ga::Mvec<T>> extractPairPoint(const c3ga::Mvec<T> &pairPoint, const T &epsilon = 1.0e-7){
 
         std::vector<c3ga::Mvec<T>> points;
-        T innerSqrt = sqrt(pairPoint | pairPoint);
+        T innerSqrt = sqrt(pairPoint.productScalar(pairPoint));
         if(innerSqrt < epsilon)
             points.push_back(pairPoint / pairPoint[c3ga::E0]);
         else {
@@ -0,0 +1,256 @@
+#include <algorithm>
+
+#include "simucore/DynamicTree.hpp"
+
+
+glimac::BBox3f DynamicTree::planetBox(const PlanetSystem& planets, size_t i) {
+    glm::vec3 r(planets.sizes[i], planets.sizes[i], planets.sizes[i]);
+    return glimac::BBox3f(planets.position(i) - r, planets.position(i) + r);
+}
+
+glimac::BBox3f DynamicTree::fatBox(const PlanetSystem& planets, size_t i) {
+    glm::vec3 m(fatMargin, fatMargin, fatMargin);
+    glimac::BBox3f box = planetBox(planets, i);
+    box = glimac::BBox3f(box.lower - m, box.upper + m);
+    glm::vec3 d = planets.direction(i) * predictedSteps; // planets move by their direction every step
+    box.grow(glimac::BBox3f(box.lower + d, box.upper + d));
+    return box;
+}
+
+float DynamicTree::area(const glimac::BBox3f& box) {
+    glm::vec3 s = box.size();
+    return 2.0f * (s.x * s.y + s.y * s.z + s.z * s.x);
+}
+
+bool DynamicTree::contains(const glimac::BBox3f& b, const glimac::BBox3f& a) {
+    for(int axis=0; axis<3; axis++) {
+        if(a.lower[axis] < b.lower[axis] || a.upper[axis] > b.upper[axis]) return false;
+    }
+    return true;
+}
+
+
+int DynamicTree::allocateNode() {
+    if(freeNodes.empty()) {
+        nodes.push_back(Node());
+        return int(nodes.size()) - 1;
+    }
+    int node = freeNodes.back();
+    freeNodes.pop_back();
+    nodes[node] = Node();
+    return node;
+}
+
+void DynamicTree::freeNode(int node) {
+    freeNodes.push_back(node);
+}
+
+
+void DynamicTree::insertLeaf(int leaf) {
+    if(root == -1) {
+        root = leaf;
+        nodes[root].parent = -1;
+        return;
+    }
+    // find the best sibling, following the cheapest child (surface area heuristic)
+    glimac::BBox3f leafBox = nodes[leaf].box;
+    int index = root;
+    while(!nodes[index].isLeaf()) {
+        int child1 = nodes[index].child1;
+        int child2 = nodes[index].child2;
+        float nodeArea = area(nodes[index].box);
+        float combinedArea = area(glimac::merge(nodes[index].box, leafBox));
+        float cost = 2.0f * combinedArea; // cost of a new parent for this node and the leaf
+        float inheritance = 2.0f * (combinedArea - nodeArea); // minimum cost of pushing the leaf further down
+        float cost1 = area(glimac::merge(leafBox, nodes[child1].box)) + inheritance;
+        if(!nodes[child1].isLeaf()) cost1 -= area(nodes[child1].box);
+        float cost2 = area(glimac::merge(leafBox, nodes[child2].box)) + inheritance;
+        if(!nodes[child2].isLeaf()) cost2 -= area(nodes[child2].box);
+        if(cost < cost1 && cost < cost2) break;
+        index = (cost1 < cost2 ? child1 : child2);
+    }
+    // create a new parent for the sibling and the leaf
+    int sibling = index;
+    int oldParent = nodes[sibling].parent;
+    int newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].box = glimac::merge(leafBox, nodes[sibling].box);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    if(oldParent != -1) {
+        if(nodes[oldParent].child1 == sibling) nodes[oldParent].child1 = newParent;
+        else nodes[oldParent].child2 = newParent;
+    }
+    else root = newParent;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+    refit(newParent);
+}
+
+void DynamicTree::removeLeaf(int leaf) {
+    if(leaf == root) {
+        root = -1;
+        return;
+    }
+    int parent = nodes[leaf].parent;
+    int grandParent = nodes[parent].parent;
+    int sibling = (nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1);
+    if(grandParent != -1) { // the sibling takes the place of the parent
+        if(nodes[grandParent].child1 == parent) nodes[grandParent].child1 = sibling;
+        else nodes[grandParent].child2 = sibling;
+        nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refit(grandParent);
+    }
+    else {
+        root = sibling;
+        nodes[sibling].parent = -1;
+        freeNode(parent);
+    }
+    nodes[leaf].parent = -1;
+}
+
+void DynamicTree::refit(int node) {
+    while(node != -1) {
+        node = balance(node);
+        int child1 = nodes[node].child1;
+        int child2 = nodes[node].child2;
+        nodes[node].height = 1 + std::max(nodes[child1].height, nodes[child2].height);
+        nodes[node].box = glimac::merge(nodes[child1].box, nodes[child2].box);
+        node = nodes[node].parent;
+    }
+}
+
+int DynamicTree::balance(int a) {
+    if(nodes[a].isLeaf() || nodes[a].height < 2) return a;
+    int b = nodes[a].child1;
+    int c = nodes[a].child2;
+    int diff = nodes[c].height - nodes[b].height;
+
+    if(diff > 1) { // rotate c up
+        int f = nodes[c].child1;
+        int g = nodes[c].child2;
+        nodes[c].child1 = a;
+        nodes[c].parent = nodes[a].parent;
+        nodes[a].parent = c;
+        if(nodes[c].parent != -1) {
+            if(nodes[nodes[c].parent].child1 == a) nodes[nodes[c].parent].child1 = c;
+            else nodes[nodes[c].parent].child2 = c;
+        }
+        else root = c;
+        if(nodes[f].height > nodes[g].height) { // f stays under c, g goes under a
+            nodes[c].child2 = f;
+            nodes[a].child2 = g;
+            nodes[g].parent = a;
+            nodes[a].box = glimac::merge(nodes[b].box, nodes[g].box);
+            nodes[c].box = glimac::merge(nodes[a].box, nodes[f].box);
+            nodes[a].height = 1 + std::max(nodes[b].height, nodes[g].height);
+            nodes[c].height = 1 + std::max(nodes[a].height, nodes[f].height);
+        }
+        else { // g stays under c, f goes under a
+            nodes[c].child2 = g;
+            nodes[a].child2 = f;
+            nodes[f].parent = a;
+            nodes[a].box = glimac::merge(nodes[b].box, nodes[f].box);
+            nodes[c].box = glimac::merge(nodes[a].box, nodes[g].box);
+            nodes[a].height = 1 + std::max(nodes[b].height, nodes[f].height);
+            nodes[c].height = 1 + std::max(nodes[a].height, nodes[g].height);
+        }
+        return c;
+    }
+
+    if(diff < -1) { // rotate b up
+        int d = nodes[b].child1;
+        int e = nodes[b].child2;
+        nodes[b].child1 = a;
+        nodes[b].parent = nodes[a].parent;
+        nodes[a].parent = b;
+        if(nodes[b].parent != -1) {
+            if(nodes[nodes[b].parent].child1 == a) nodes[nodes[b].parent].child1 = b;
+            else nodes[nodes[b].parent].child2 = b;
+        }
+        else root = b;
+        if(nodes[d].height > nodes[e].height) { // d stays under b, e goes under a
+            nodes[b].child2 = d;
+            nodes[a].child1 = e;
+            nodes[e].parent = a;
+            nodes[a].box = glimac::merge(nodes[c].box, nodes[e].box);
+            nodes[b].box = glimac::merge(nodes[a].box, nodes[d].box);
+            nodes[a].height = 1 + std::max(nodes[c].height, nodes[e].height);
+            nodes[b].height = 1 + std::max(nodes[a].height, nodes[d].height);
+        }
+        else { // e stays under b, d goes under a
+            nodes[b].child2 = e;
+            nodes[a].child1 = d;
+            nodes[d].parent = a;
+            nodes[a].box = glimac::merge(nodes[c].box, nodes[d].box);
+            nodes[b].box = glimac::merge(nodes[a].box, nodes[e].box);
+            nodes[a].height = 1 + std::max(nodes[c].height, nodes[d].height);
+            nodes[b].height = 1 + std::max(nodes[a].height, nodes[e].height);
+        }
+        return b;
+    }
+
+    return a;
+}
+
+
+void DynamicTree::findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) {
+    step++;
+
+    // INSERTION AND MOVEMENT OF THE LEAVES
+    for(size_t i=0; i<planets.size(); i++) {
+        auto found = leafOfId.find(planets.ids[i]);
+        int leaf;
+        if(found == leafOfId.end()) { // new planet
+            leaf = allocateNode();
+            nodes[leaf].id = planets.ids[i];
+            nodes[leaf].box = fatBox(planets, i);
+            leafOfId[planets.ids[i]] = leaf;
+            insertLeaf(leaf);
+        }
+        else {
+            leaf = found->second;
+            if(!contains(nodes[leaf].box, planetBox(planets, i))) { // out of its fattened box
+                removeLeaf(leaf);
+                nodes[leaf].box = fatBox(planets, i);
+                insertLeaf(leaf);
+            }
+        }
+        nodes[leaf].index = i;
+        nodes[leaf].lastStep = step;
+    }
+
+    // REMOVAL OF THE LOST PLANETS
+    for(auto it = leafOfId.begin(); it != leafOfId.end(); ) {
+        if(nodes[it->second].lastStep != step) {
+            removeLeaf(it->second);
+            freeNode(it->second);
+            it = leafOfId.erase(it);
+        }
+        else ++it;
+    }
+
+    // QUERIES (tight box of each planet against the fattened leaves)
+    pairs.clear();
+    if(root == -1) return;
+    for(size_t i=0; i<planets.size(); i++) {
+        glimac::BBox3f box = planetBox(planets, i);
+        stack.clear();
+        stack.push_back(root);
+        while(!stack.empty()) {
+            int node = stack.back();
+            stack.pop_back();
+            if(glimac::disjoint(nodes[node].box, box)) continue;
+            if(nodes[node].isLeaf()) {
+                if(nodes[node].index > int(i)) pairs.push_back(CandidatePair(i, nodes[node].index));
+            }
+            else {
+                stack.push_back(nodes[node].child1);
+                stack.push_back(nodes[node].child2);
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end()); // same order as the brute force
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <thread>
+
+#include "simucore/NarrowPhase.hpp"
+
+
+NarrowPhase::NarrowPhase(int threads) {
+    if(threads <= 0) threads = int(std::thread::hardware_concurrency());
+    nbThreads = std::max(threads, 1);
+    if(nbThreads > 1) pool.reset(new Eigen::ThreadPool(nbThreads - 1)); // the calling thread works too
+}
+
+template<typename F>
+void NarrowPhase::parallelFor(size_t n, size_t minItems, F f) {
+    size_t nbChunks = std::min(size_t(nbThreads * chunksPerThread), n / minItems);
+    if(!pool || nbChunks < 2) { // not worth the threads
+        f(size_t(0), n);
+        return;
+    }
+    size_t chunkSize = (n + nbChunks - 1) / nbChunks;
+    Eigen::Barrier barrier(nbChunks - 1);
+    for(size_t c=1; c<nbChunks; c++) {
+        size_t begin = std::min(c * chunkSize, n), end = std::min(begin + chunkSize, n);
+        pool->Schedule([&f, &barrier, begin, end]() {
+            f(begin, end);
+            barrier.Notify();
+        });
+    }
+    f(size_t(0), std::min(chunkSize, n)); // first chunk on the calling thread
+    barrier.Wait();
+}
+
+void NarrowPhase::testRange(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs,
+                            std::vector<uint8_t>& hits, size_t begin, size_t end) const {
+    c3ga::batch::invoke([&]() { // compiled for the instruction set of the processor
+        c3ga::batch::dualSpheresIntersectFiltered(planets.posX.data(), planets.posY.data(), planets.posZ.data(), planets.sizes.data(),
+                                                  errorScales.data(), dualSpheres.data(), planets.size(),
+                                                  pairs.data() + begin, end - begin, hits.data() + begin);
+    });
+    for(size_t p=begin; p<end; p++) {
+        if(!planets.loaded[pairs[p].first] || !planets.loaded[pairs[p].second]) hits[p] = 0;
+    }
+}
+
+void NarrowPhase::testPairs(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs, std::vector<uint8_t>& hits) {
+    hits.assign(pairs.size(), 0);
+    if(pairs.empty()) return;
+    dualSpheres.resize(5 * planets.size()); // the memory is kept from one step to the next
+    errorScales.resize(planets.size());
+    c3ga::batch::invoke([&]() { // every planet, cheaper than finding the ones in a pair
+        c3ga::batch::dualSpheres(planets.posX.data(), planets.posY.data(), planets.posZ.data(), planets.sizes.data(),
+                                 planets.size(), dualSpheres.data());
+        c3ga::batch::dualSphereErrorScales(planets.posX.data(), planets.posY.data(), planets.posZ.data(), planets.sizes.data(),
+                                           planets.size(), errorScales.data());
+    });
+    parallelFor(pairs.size(), minPairsPerChunk, [this, &planets, &pairs, &hits](size_t begin, size_t end) {
+        testRange(planets, pairs, hits, begin, end);
+    });
+}
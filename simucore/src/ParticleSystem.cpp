@@ -0,0 +1,41 @@
+#include "simucore/ParticleSystem.hpp"
+
+
+ParticleSystem::ParticleSystem(size_t capacity) :
+    posX(capacity), posY(capacity), posZ(capacity), dirX(capacity), dirY(capacity), dirZ(capacity), sizes(capacity) {}
+
+
+bool ParticleSystem::add(glm::vec3 position, glm::vec3 direction, float size) {
+    if(count == capacity()) return false;
+    posX[count] = position.x; posY[count] = position.y; posZ[count] = position.z;
+    dirX[count] = direction.x; dirY[count] = direction.y; dirZ[count] = direction.z;
+    sizes[count] = size;
+    count++;
+    return true;
+}
+
+/* move and shrink n particles, the arrays do not overlap */
+static void advanceKernel(float* __restrict x, float* __restrict y, float* __restrict z,
+                          const float* __restrict dx, const float* __restrict dy, const float* __restrict dz,
+                          float* __restrict s, size_t n, float speed, float rate) {
+    for(size_t i=0; i<n; i++) { // no branch and no dependency, the loop is vectorized
+        x[i] += dx[i] * speed;
+        y[i] += dy[i] * speed;
+        z[i] += dz[i] * speed;
+        s[i] /= rate;
+    }
+}
+
+void ParticleSystem::advance(float speed, float rate) {
+    advanceKernel(posX.data(), posY.data(), posZ.data(), dirX.data(), dirY.data(), dirZ.data(), sizes.data(), count, speed, rate);
+}
+
+void ParticleSystem::removeSmallerThan(float size) {
+    for(size_t i=0; i<count; ) {
+        if(sizes[i] > size) { i++; continue; }
+        count--; // the last particle takes the place of the dead one, and is checked next
+        posX[i] = posX[count]; posY[i] = posY[count]; posZ[i] = posZ[count];
+        dirX[i] = dirX[count]; dirY[i] = dirY[count]; dirZ[i] = dirZ[count];
+        sizes[i] = sizes[count];
+    }
+}
@@ -0,0 +1,108 @@
+#include "simucore/PlanetSystem.hpp"
+
+
+void PlanetSystem::add(const Planet& planet) {
+    posX.push_back(planet.position.x); posY.push_back(planet.position.y); posZ.push_back(planet.position.z);
+    dirX.push_back(planet.direction.x); dirY.push_back(planet.direction.y); dirZ.push_back(planet.direction.z);
+    sizes.push_back(planet.size);
+    ids.push_back(planet.id);
+    dirUpdateNbs.push_back(planet.dirUpdateNb);
+    loaded.push_back(planet.hasLoaded);
+    textureIdxs.push_back(planet.textureIdx);
+    obliquities.push_back(planet.obliquity);
+    rotationSpeeds.push_back(planet.rotationSpeed);
+    inclinations.push_back(planet.inclination);
+    spawnTimes.push_back(planet.spawnTime);
+    durationsOfLoad.push_back(planet.durationOfLoad);
+    visibilities.push_back(planet.visibility);
+    visibilityOps.push_back(planet.visibilityOp);
+    prevX.push_back(planet.position.x); prevY.push_back(planet.position.y); prevZ.push_back(planet.position.z);
+}
+
+Planet PlanetSystem::get(size_t i) const {
+    Planet planet(ids[i], textureIdxs[i], sizes[i], position(i), obliquities[i], rotationSpeeds[i],
+                  inclinations[i], direction(i), spawnTimes[i]);
+    planet.durationOfLoad = durationsOfLoad[i];
+    planet.hasLoaded = loaded[i];
+    planet.visibility = visibilities[i];
+    planet.visibilityOp = visibilityOps[i];
+    planet.dirUpdateNb = dirUpdateNbs[i];
+    return planet;
+}
+
+
+void PlanetSystem::moveTo(size_t j, size_t i) {
+    posX[i] = posX[j]; posY[i] = posY[j]; posZ[i] = posZ[j];
+    dirX[i] = dirX[j]; dirY[i] = dirY[j]; dirZ[i] = dirZ[j];
+    sizes[i] = sizes[j];
+    ids[i] = ids[j];
+    dirUpdateNbs[i] = dirUpdateNbs[j];
+    loaded[i] = loaded[j];
+    textureIdxs[i] = textureIdxs[j];
+    obliquities[i] = obliquities[j];
+    rotationSpeeds[i] = rotationSpeeds[j];
+    inclinations[i] = inclinations[j];
+    spawnTimes[i] = spawnTimes[j];
+    durationsOfLoad[i] = durationsOfLoad[j];
+    visibilities[i] = visibilities[j];
+    visibilityOps[i] = visibilityOps[j];
+    prevX[i] = prevX[j]; prevY[i] = prevY[j]; prevZ[i] = prevZ[j];
+}
+
+void PlanetSystem::resize(size_t n) {
+    posX.resize(n); posY.resize(n); posZ.resize(n);
+    dirX.resize(n); dirY.resize(n); dirZ.resize(n);
+    sizes.resize(n);
+    ids.resize(n);
+    dirUpdateNbs.resize(n);
+    loaded.resize(n);
+    textureIdxs.resize(n);
+    obliquities.resize(n);
+    rotationSpeeds.resize(n);
+    inclinations.resize(n);
+    spawnTimes.resize(n);
+    durationsOfLoad.resize(n);
+    visibilities.resize(n);
+    visibilityOps.resize(n);
+    prevX.resize(n); prevY.resize(n); prevZ.resize(n);
+}
+
+void PlanetSystem::remove(const std::vector<uint8_t>& removed) {
+    size_t kept = 0;
+    for(size_t i=0; i<size(); i++) {
+        if(i < removed.size() && removed[i]) continue;
+        if(kept != i) moveTo(i, kept);
+        kept++;
+    }
+    resize(kept);
+}
+
+void PlanetSystem::removeSmallerThan(float size) {
+    std::vector<uint8_t> removed(sizes.size());
+    for(size_t i=0; i<sizes.size(); i++) {
+        removed[i] = (sizes[i] <= size);
+    }
+    remove(removed);
+}
+
+void PlanetSystem::reserve(size_t n) {
+    posX.reserve(n); posY.reserve(n); posZ.reserve(n);
+    dirX.reserve(n); dirY.reserve(n); dirZ.reserve(n);
+    sizes.reserve(n);
+    ids.reserve(n);
+    dirUpdateNbs.reserve(n);
+    loaded.reserve(n);
+    textureIdxs.reserve(n);
+    obliquities.reserve(n);
+    rotationSpeeds.reserve(n);
+    inclinations.reserve(n);
+    spawnTimes.reserve(n);
+    durationsOfLoad.reserve(n);
+    visibilities.reserve(n);
+    visibilityOps.reserve(n);
+    prevX.reserve(n); prevY.reserve(n); prevZ.reserve(n);
+}
+
+void PlanetSystem::clear() {
+    resize(0);
+}
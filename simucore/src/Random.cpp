@@ -0,0 +1,30 @@
+#include <cmath>
+
+#include "simucore/Random.hpp"
+
+
+uint64_t Random::seed = 0;
+
+
+void Random::fillUniform(float* out, size_t n, uint64_t key, uint64_t step, uint64_t first, float min, float max) {
+    const uint64_t base = streamBase(key, step);
+    const float range = max - min;
+    for(size_t k=0; k<n; k++) { // no dependency between the numbers, the loop can be vectorized
+        out[k] = min + range * toUnit(at(base, first + k));
+    }
+}
+
+void Random::fillUniform(float* out, const unsigned int* keys, size_t n, uint64_t step, uint64_t k, float min, float max) {
+    const float range = max - min;
+    for(size_t i=0; i<n; i++) {
+        out[i] = min + range * toUnit(at(streamBase(keys[i], step), k));
+    }
+}
+
+
+glm::vec3 RandomStream::sphericalRand(float radius) {
+    float z = uniform(-1.0f, 1.0f);
+    float a = uniform(0.0f, 6.283185307179586f);
+    float r = std::sqrt(1.0f - z * z);
+    return glm::vec3(r * std::cos(a), r * std::sin(a), z) * radius;
+}
@@ -0,0 +1,191 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "simucore/Simulation.hpp"
+
+
+// ============================================================
+// CREATION FUNCTIONS
+// ============================================================
+
+/* select the remaining random parameters of a new planet */
+Planet buildPlanet(unsigned int id, RandomStream& random, double actualTime, int size, glm::vec3 position, int textureIdx) {
+    if(textureIdx < 0) textureIdx = Planet::selectTextureIdx(random);
+    float obliquity = Planet::selectObliquity(random);
+    float rotationSpeed = Planet::selectRotationSpeed(random);
+    glm::vec3 inclination = Planet::selectInclination(random);
+    glm::vec3 direction = Planet::selectDirection(random);
+    return Planet(id, textureIdx, size, position, obliquity, rotationSpeed, inclination, direction, actualTime);
+}
+
+Planet createPlanet(Info* info) {
+    unsigned int id = info->newPlanetId();
+    RandomStream random(id, info->getStep());
+    int size = Planet::selectSize(random);
+    glm::vec3 position = Planet::selectPosition(random);
+    return buildPlanet(id, random, info->getTime(), size, position, -1);
+}
+
+Planet createPlanet(Info* info, int size, glm::vec3 position, int textureIdx) {
+    unsigned int id = info->newPlanetId();
+    RandomStream random(id, info->getStep());
+    return buildPlanet(id, random, info->getTime(), size, position, textureIdx);
+}
+
+PlanetSystem createAllPlanets(int nb, Info* info) {
+    PlanetSystem planets;
+    planets.reserve(nb);
+    for(int n=0; n<nb; n++) {
+        planets.add(createPlanet(info));
+    }
+    return planets;
+}
+
+void addExplosion(ParticleSystem* explosions, int size, glm::vec3 position, RandomStream& random) {
+    int NB = Planet::selectExplodingFragments(random);
+    for(int n=0; n<NB; n++) {
+        explosions->add(position, Planet::selectDirection(random), size); // dropped if there are too many particles
+    }
+}
+
+
+// ============================================================
+// UPDATE FUNCTIONS
+// ============================================================
+
+/* bounce (bounce[i] == -1) and move n planets, the arrays do not overlap */
+static void moveKernel(float* __restrict posX, float* __restrict posY, float* __restrict posZ,
+                       float* __restrict dirX, float* __restrict dirY, float* __restrict dirZ,
+                       unsigned int* __restrict dirUpdateNbs, const float* __restrict bounce, size_t n) {
+    for(size_t i=0; i<n; i++) { // no branch and no dependency, the loop is vectorized
+        dirX[i] *= bounce[i]; dirY[i] *= bounce[i]; dirZ[i] *= bounce[i];
+        posX[i] += dirX[i]; posY[i] += dirY[i]; posZ[i] += dirZ[i];
+        dirUpdateNbs[i]++;
+    }
+}
+
+int updateEverything(PlanetSystem* planets, ParticleSystem* explosions, Info* info, BroadPhase* broadPhase, NarrowPhase* narrowPhase,
+                     UpdateBuffers* buffers) {
+    const size_t N = planets->size();
+    const uint64_t step = info->getStep();
+    float* posX = planets->posX.data(); float* posY = planets->posY.data(); float* posZ = planets->posZ.data();
+    float* dirX = planets->dirX.data(); float* dirY = planets->dirY.data(); float* dirZ = planets->dirZ.data();
+    unsigned int* dirUpdateNbs = planets->dirUpdateNbs.data();
+    // HITBOX VERIF (-1 if the planet is out of the hitbox and needs to bounce)
+    AlignedVector<float>& bounce = buffers->bounce;
+    bounce.resize(N);
+    const float distanceMax2 = float(Planet::distanceMax) * float(Planet::distanceMax);
+    for(size_t i=0; i<N; i++) { // squared length, sqrt would prevent the vectorization (errno)
+        float length2 = posX[i] * posX[i] + posY[i] * posY[i] + posZ[i] * posZ[i];
+        bounce[i] = (length2 > distanceMax2 ? -1.0f : 1.0f);
+    }
+    std::vector<unsigned int>& turning = buffers->turning; // planets changing of direction
+    turning.clear();
+    for(size_t i=0; i<N; i++) { // rare cases, not vectorized
+        if(bounce[i] < 0.0f) planets->inclinations[i] = -1.0f * planets->inclinations[i];
+        else if(dirUpdateNbs[i] % Planet::dirUpdateRate == 0) turning.push_back(i); // chance of changing direction
+    }
+    if(!turning.empty()) { // new directions drawn in bulk, same values as Planet::selectDirection
+        std::vector<unsigned int>& keys = buffers->keys;
+        std::vector<float>& z = buffers->z;
+        std::vector<float>& a = buffers->a;
+        keys.resize(turning.size()); z.resize(turning.size()); a.resize(turning.size());
+        for(size_t t=0; t<turning.size(); t++) keys[t] = planets->ids[turning[t]];
+        Random::fillUniform(z.data(), keys.data(), keys.size(), step, 0, -1.0f, 1.0f);
+        Random::fillUniform(a.data(), keys.data(), keys.size(), step, 1, 0.0f, 6.283185307179586f);
+        for(size_t t=0; t<turning.size(); t++) {
+            float r = std::sqrt(1.0f - z[t] * z[t]);
+            glm::vec3 direction = glm::normalize(glm::vec3(r * std::cos(a[t]), r * std::sin(a[t]), z[t]));
+            size_t i = turning[t];
+            dirX[i] = direction.x; dirY[i] = direction.y; dirZ[i] = direction.z;
+            dirUpdateNbs[i] = 0;
+        }
+    }
+    // MOVEMENT
+    std::copy(posX, posX + N, planets->prevX.begin());
+    std::copy(posY, posY + N, planets->prevY.begin());
+    std::copy(posZ, posZ + N, planets->prevZ.begin());
+    moveKernel(posX, posY, posZ, dirX, dirY, dirZ, dirUpdateNbs, bounce.data(), N);
+    // COLLISION DETECTION
+    std::vector<uint8_t>& collided = buffers->collided; // collided planets, as flags and as a list of indexes
+    std::vector<int>& collidedList = buffers->collidedList;
+    collided.assign(N, 0);
+    collidedList.clear();
+    int nbCollisions = 0;
+    std::vector<CandidatePair>& pairs = buffers->pairs;
+    std::vector<uint8_t>& hits = buffers->hits;
+    broadPhase->findPairs(*planets, pairs); // broad phase
+    narrowPhase->testPairs(*planets, pairs, hits); // narrow phase (not loaded planets never hit)
+    const float* sizes = planets->sizes.data();
+    for(size_t p=0; p<pairs.size(); p++) { // merge the hits in the order of the pairs
+        if(!hits[p]) continue;
+        int i = pairs[p].first, j = pairs[p].second;
+        if(collided[i] || collided[j]) continue; // already collided
+        // collision detected
+        if(info->logEvents()) std::cout << "Collision! (" << i << ", " << j << ")" << std::endl;
+        nbCollisions++;
+        if((sizes[i] > Planet::minC && sizes[j] > Planet::minC) || (sizes[i] <= Planet::minC && sizes[j] <= Planet::minC)) {
+            collided[i] = 1; collidedList.push_back(i);
+            collided[j] = 1; collidedList.push_back(j);
+        }
+        else { // special collision if very small planet collide with big planet
+            int k = (sizes[i] <= Planet::minC ? i : j);
+            collided[k] = 1; collidedList.push_back(k);
+        }
+    }
+    // COLLISION RESULT
+    int nbC = 0; int sizeC = 0; glm::vec3 posC;
+    std::sort(collidedList.begin(), collidedList.end(), std::greater<int>()); // from the last planet to the first
+    for(auto i = collidedList.begin(); i != collidedList.end(); i++) {
+        float size = planets->sizes[*i]; glm::vec3 position = planets->position(*i); // get collided planet
+        if(size > Planet::minC) { // generate new data if the planet is not too small
+            if(size > sizeC) sizeC = size;
+            posC = position; nbC++; }
+        RandomStream random(Random::explosionKey + planets->ids[*i], step); // random stream of the explosion of this planet
+        addExplosion(explosions, size, position, random); // add explosion
+        if(nbC == 2) { // create new data for every collision of not too small planets (2 planets in collision)
+            float s = float(sizeC) / 2.0;
+            nbC = 0; sizeC = 0;
+            if(s < Planet::minC) continue; // only accept not too small planets
+            int NB = Planet::selectExplodingFragments(random);
+            for(int n=0; n<NB; n++) { // create new planets (exploding fragments)
+                planets->add(createPlanet(info, s, posC));
+            }
+        }
+    }
+    if(!collidedList.empty()) planets->remove(collided); // remove collided planets, new planets are after the flags so they are kept
+    // EXPLOSION EFFECTS
+    explosions->advance(Planet::explosionSpeed, Planet::explosionRate); // explosion particles movement + getting smaller
+    explosions->removeSmallerThan(Planet::explosionMinSize); // remove small explosions
+    // SPECIAL EVENTS
+    if(info->specialSpawn()) { // spawn a new planet
+        if(info->logEvents()) std::cout << "Spawning a new planet!" << std::endl;
+        planets->add(createPlanet(info));
+        info->modifySpecialSpawn(); }
+    if(info->specialClean()) { // delete all small planets
+        if(info->logEvents()) std::cout << "Deleting all small planets." << std::endl;
+        planets->removeSmallerThan(Planet::minC);
+        info->modifySpecialClean();
+    }
+    info->nextStep();
+    return nbCollisions;
+}
+
+
+void updateVisibility(PlanetSystem* planets, Info info) {
+    for(size_t i=0; i<planets->size(); i++) {
+        if(planets->loaded[i]) continue; // skip loaded planets
+        float& visibility = planets->visibilities[i];
+        float& visibilityOp = planets->visibilityOps[i];
+        if(planets->durationsOfLoad[i] - planets->spawnTimes[i] >= Planet::loadPeriod) { // load finish
+            planets->loaded[i] = true;
+            visibility = 1.0;
+            continue;}
+        else planets->durationsOfLoad[i] = info.getTime(); // load not finish
+        if(visibility >= 1.0) visibilityOp = -0.1;
+        if(visibility <= 0.1) visibilityOp = 0.1;
+        visibility += visibilityOp; // flashing effect when not loaded (modify visibility)
+    }
+}
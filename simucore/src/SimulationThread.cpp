@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <chrono>
+
+#include "simucore/SimulationThread.hpp"
+
+
+SimulationThread::SimulationThread(int nbPlanets) {
+    planets = createAllPlanets(nbPlanets, &info);
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+
+void SimulationThread::start() {
+    if(running) return;
+    publish(); // the render thread can draw the initial planets
+    snapshots.update();
+    running = true;
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() {
+    running = false;
+    if(thread.joinable()) thread.join();
+}
+
+
+void SimulationThread::publish() {
+    Snapshot& snapshot = snapshots.writeBuffer();
+    snapshot.capture(planets, explosions);
+    double scale = timeScale;
+    snapshot.step = info.getStep();
+    snapshot.time = clock.now();
+    snapshot.alpha = stepClock.alpha();
+    snapshot.stepInterval = (scale > 0.0 ? stepClock.getStepDuration() / scale : 0.0);
+    snapshots.publish();
+}
+
+void SimulationThread::run() {
+    while(running) {
+        double scale = timeScale;
+        int nbSteps = stepClock.advance(clock.now(), scale);
+        for(int step=0; step<nbSteps; step++) {
+            if(spawnRequest.exchange(false) && !info.specialSpawn()) info.modifySpecialSpawn();
+            if(cleanRequest.exchange(false) && !info.specialClean()) info.modifySpecialClean();
+            updateVisibility(&planets, info); // visibility update func
+            updateEverything(&planets, &explosions, &info, &broadPhase, &narrowPhase, &updateBuffers); // main update func
+        }
+        if(nbSteps > 0) publish();
+        // wait for the next step, but not too long to stay responsive to pauses and speed changes
+        double wait = (scale > 0.0 ? (1.0 - stepClock.alpha()) * stepClock.getStepDuration() / scale : 0.01);
+        std::this_thread::sleep_for(std::chrono::duration<double>(std::min(wait, 0.01)));
+    }
+}
@@ -0,0 +1,25 @@
+#include "simucore/Snapshot.hpp"
+
+
+void Snapshot::capture(const PlanetSystem& planets, const ParticleSystem& explosions) {
+    const size_t N = planets.size();
+    previous.resize(N); positions.resize(N);
+    for(size_t i=0; i<N; i++) {
+        previous[i] = glm::vec3(planets.prevX[i], planets.prevY[i], planets.prevZ[i]);
+        positions[i] = planets.position(i);
+    }
+    sizes.assign(planets.sizes.begin(), planets.sizes.end());
+    visibilities.assign(planets.visibilities.begin(), planets.visibilities.end());
+    textureIdxs.assign(planets.textureIdxs.begin(), planets.textureIdxs.end());
+    obliquities.assign(planets.obliquities.begin(), planets.obliquities.end());
+    rotationSpeeds.assign(planets.rotationSpeeds.begin(), planets.rotationSpeeds.end());
+    inclinations.assign(planets.inclinations.begin(), planets.inclinations.end());
+
+    const size_t E = explosions.size();
+    particlePrevious.resize(E); particles.resize(E);
+    for(size_t i=0; i<E; i++) { // every particle moved and shrank during the last step
+        particles[i] = glm::vec4(explosions.position(i), explosions.sizes[i]);
+        particlePrevious[i] = glm::vec4(explosions.position(i) - explosions.direction(i) * Planet::explosionSpeed,
+                                        explosions.sizes[i] * Planet::explosionRate);
+    }
+}
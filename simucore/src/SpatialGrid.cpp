@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cmath>
+
+#include "simucore/SpatialGrid.hpp"
+
+
+uint64_t SpatialGrid::cellKey(int64_t x, int64_t y, int64_t z) {
+    // 21 bits per axis: far away cells can share a key, which only adds candidates
+    const uint64_t mask = (1u << 21) - 1;
+    return ((uint64_t(x) & mask) << 42) | ((uint64_t(y) & mask) << 21) | (uint64_t(z) & mask);
+}
+
+int64_t SpatialGrid::cellCoord(float p) const {
+    return int64_t(std::floor(p / cellSize));
+}
+
+
+void SpatialGrid::findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) {
+    pairs.clear();
+    entries.clear();
+    cells.clear();
+    if(planets.size() < 2) return;
+
+    // GRID SIZE
+    float sizeMax = 0.0;
+    for(size_t i=0; i<planets.size(); i++) {
+        if(planets.sizes[i] > sizeMax) sizeMax = planets.sizes[i];
+    }
+    cellSize = (sizeMax > 0.0 ? 2.0f * sizeMax : 1.0f);
+
+    // INSERTION
+    for(size_t i=0; i<planets.size(); i++) {
+        entries.push_back(std::make_pair(cellKey(cellCoord(planets.posX[i]), cellCoord(planets.posY[i]), cellCoord(planets.posZ[i])), int(i)));
+    }
+    std::sort(entries.begin(), entries.end());
+    for(size_t e=0; e<entries.size(); ) {
+        size_t end = e + 1;
+        while(end < entries.size() && entries[end].first == entries[e].first) end++;
+        cells[entries[e].first] = std::make_pair(int(e), int(end));
+        e = end;
+    }
+
+    // QUERY (own cell, then the 13 neighbours of the "forward" half so each pair is found once)
+    for(size_t e=0; e<entries.size(); ) {
+        const std::pair<int, int> range = cells[entries[e].first];
+        int first = entries[e].second;
+        int64_t x = cellCoord(planets.posX[first]), y = cellCoord(planets.posY[first]), z = cellCoord(planets.posZ[first]);
+        for(int a=range.first; a<range.second; a++) {
+            for(int b=a+1; b<range.second; b++) {
+                int i = entries[a].second, j = entries[b].second;
+                pairs.push_back(CandidatePair(std::min(i, j), std::max(i, j)));
+            }
+        }
+        for(int dx=0; dx<=1; dx++) {
+            for(int dy=(dx == 0 ? 0 : -1); dy<=1; dy++) {
+                for(int dz=(dx == 0 && dy == 0 ? 1 : -1); dz<=1; dz++) {
+                    auto other = cells.find(cellKey(x + dx, y + dy, z + dz));
+                    if(other == cells.end()) continue;
+                    for(int a=range.first; a<range.second; a++) {
+                        for(int b=other->second.first; b<other->second.second; b++) {
+                            int i = entries[a].second, j = entries[b].second;
+                            pairs.push_back(CandidatePair(std::min(i, j), std::max(i, j)));
+                        }
+                    }
+                }
+            }
+        }
+        e = range.second;
+    }
+    std::sort(pairs.begin(), pairs.end()); // same order as the brute force
+}
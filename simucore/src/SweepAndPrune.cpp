@@ -0,0 +1,145 @@
+#include <algorithm>
+
+#include "simucore/SweepAndPrune.hpp"
+
+
+uint64_t SweepAndPrune::pairKey(unsigned int a, unsigned int b) {
+    if(a > b) std::swap(a, b);
+    return (uint64_t(a) << 32) | uint64_t(b);
+}
+
+void SweepAndPrune::setBounds(Proxy& proxy, const PlanetSystem& planets, int i) {
+    const float position[3] = {planets.posX[i], planets.posY[i], planets.posZ[i]};
+    for(int axis=0; axis<3; axis++) {
+        proxy.lower[axis] = position[axis] - planets.sizes[i];
+        proxy.upper[axis] = position[axis] + planets.sizes[i];
+    }
+}
+
+bool SweepAndPrune::overlap(int a, int b) const {
+    const Proxy& p = proxies[a];
+    const Proxy& q = proxies[b];
+    for(int axis=0; axis<3; axis++) {
+        if(p.lower[axis] > q.upper[axis] || q.lower[axis] > p.upper[axis]) return false;
+    }
+    return true;
+}
+
+void SweepAndPrune::updatePair(int a, int b) {
+    unsigned int idA = proxies[a].id, idB = proxies[b].id;
+    uint64_t key = pairKey(idA, idB);
+    if(overlap(a, b)) {
+        if(overlaps.insert(key).second) addedPairs.push_back(std::make_pair(std::min(idA, idB), std::max(idA, idB)));
+    }
+    else if(overlaps.erase(key) > 0) removedPairs.push_back(std::make_pair(std::min(idA, idB), std::max(idA, idB)));
+}
+
+void SweepAndPrune::insertProxy(const PlanetSystem& planets, int index) {
+    int p;
+    if(freeProxies.empty()) {
+        p = int(proxies.size());
+        proxies.push_back(Proxy());
+    }
+    else {
+        p = freeProxies.back();
+        freeProxies.pop_back();
+    }
+    Proxy& proxy = proxies[p];
+    proxy.id = planets.ids[index];
+    proxy.index = index;
+    proxy.lastStep = step;
+    proxy.alive = true;
+    setBounds(proxy, planets, index);
+    proxyOfId[proxy.id] = p;
+    // the new bounds are added after every other bounds: the box starts without any overlap,
+    // and the insertion sort moves them to their place, reporting the overlaps on the way
+    for(int axis=0; axis<3; axis++) {
+        endpoints[axis].push_back(Endpoint{proxy.lower[axis], p, false});
+        endpoints[axis].push_back(Endpoint{proxy.upper[axis], p, true});
+    }
+}
+
+void SweepAndPrune::removeLostProxies() {
+    bool lost = false;
+    for(size_t p=0; p<proxies.size(); p++) {
+        if(!proxies[p].alive || proxies[p].lastStep == step) continue;
+        proxies[p].alive = false;
+        proxyOfId.erase(proxies[p].id);
+        freeProxies.push_back(p);
+        lost = true;
+    }
+    if(!lost) return;
+    for(int axis=0; axis<3; axis++) { // remove the bounds of lost planets, the order is kept
+        endpoints[axis].erase(std::remove_if(endpoints[axis].begin(), endpoints[axis].end(),
+            [this](const Endpoint& e) {return !proxies[e.proxy].alive;}), endpoints[axis].end());
+    }
+    for(auto it = overlaps.begin(); it != overlaps.end(); ) { // remove the pairs of lost planets
+        unsigned int a = (unsigned int)(*it >> 32), b = (unsigned int)(*it & 0xFFFFFFFF);
+        if(proxyOfId.find(a) == proxyOfId.end() || proxyOfId.find(b) == proxyOfId.end()) {
+            removedPairs.push_back(std::make_pair(a, b));
+            it = overlaps.erase(it);
+        }
+        else ++it;
+    }
+}
+
+void SweepAndPrune::sortAxis(int axis) {
+    std::vector<Endpoint>& list = endpoints[axis];
+    for(size_t k=1; k<list.size(); k++) {
+        Endpoint e = list[k];
+        size_t j = k;
+        // at equal values lower bounds go first, so touching boxes overlap
+        while(j > 0 && (e.value < list[j-1].value || (e.value == list[j-1].value && !e.isUpper && list[j-1].isUpper))) {
+            const Endpoint& other = list[j-1];
+            if(e.isUpper != other.isUpper && e.proxy != other.proxy) updatePair(e.proxy, other.proxy); // lower passes an upper
+            list[j] = list[j-1];
+            j--;
+        }
+        list[j] = e;
+    }
+}
+
+
+void SweepAndPrune::findPairs(const PlanetSystem& planets, std::vector<CandidatePair>& pairs) {
+    step++;
+    addedPairs.clear();
+    removedPairs.clear();
+
+    // UPDATE OF THE BOXES
+    std::vector<int> newPlanets;
+    for(size_t i=0; i<planets.size(); i++) {
+        auto found = proxyOfId.find(planets.ids[i]);
+        if(found == proxyOfId.end()) {
+            newPlanets.push_back(i);
+            continue;
+        }
+        Proxy& proxy = proxies[found->second];
+        proxy.index = i;
+        proxy.lastStep = step;
+        setBounds(proxy, planets, i);
+    }
+    removeLostProxies();
+    for(size_t n=0; n<newPlanets.size(); n++) {
+        insertProxy(planets, newPlanets[n]);
+    }
+    for(int axis=0; axis<3; axis++) {
+        for(size_t k=0; k<endpoints[axis].size(); k++) {
+            Endpoint& e = endpoints[axis][k];
+            e.value = (e.isUpper ? proxies[e.proxy].upper[axis] : proxies[e.proxy].lower[axis]);
+        }
+    }
+
+    // SWEEP
+    for(int axis=0; axis<3; axis++) {
+        sortAxis(axis);
+    }
+
+    // OVERLAPPING PAIRS
+    pairs.clear();
+    for(auto it = overlaps.begin(); it != overlaps.end(); ++it) {
+        int i = proxies[proxyOfId[(unsigned int)(*it >> 32)]].index;
+        int j = proxies[proxyOfId[(unsigned int)(*it & 0xFFFFFFFF)]].index;
+        pairs.push_back(CandidatePair(std::min(i, j), std::max(i, j)));
+    }
+    std::sort(pairs.begin(), pairs.end()); // same order as the brute force
+}
@@ -121,30 +121,6 @@ GLuint* getDataOfModels(std::vector<Model> models, int type) {
 }
 
 
-/**Create one planet from the parameters, if given, or else select random parameters*/
-Planet createPlanet(double actualTime, int size = Planet::selectSize(), glm::vec3 position = Planet::selectPosition(),
-                    int textureIdx = Planet::selectTextureIdx(), float obliquity = Planet::selectObliquity(),
-                    float rotationSpeed = Planet::selectRotationSpeed(), glm::vec3 inclination = Planet::selectInclination()) {
-    return Planet(textureIdx, size, position, obliquity, rotationSpeed, inclination, actualTime);
-}
-
-std::vector<Planet> createAllPlanets(int nb, double actualTime) {
-    std::vector<Planet> planets;
-    for(int n=0; n<nb; n++) {
-        planets.push_back(createPlanet(actualTime));
-    }
-    return planets;
-}
-
-/**Add a new explosion in the explosions vector*/
-void addExplosion(std::vector<Planet>* explosions, double actualTime, int size, glm::vec3 position) {
-    int NB = Planet::selectExplodingFragments();
-    for(int n=0; n<NB; n++) {
-        explosions->push_back(createPlanet(actualTime, size, position, 37)); // textureIdx==37 is white texture
-    }
-}
-
-
 // ============================================================
 // DRAW FUNCTIONS
 // ============================================================
@@ -168,17 +144,17 @@ void drawHitbox(PlanetProgram* program, std::vector<GLuint> textures, std::vecto
 }
 
 // Draw the ring for the asked planet
-void drawRing(Planet planet, PlanetProgram* program, Info info, std::vector<GLuint> textures, std::vector<Model> models, std::vector<glm::mat4> matrix) {
+void drawRing(const Snapshot& snapshot, size_t i, glm::vec3 position, PlanetProgram* program, const Info& info, const std::vector<GLuint>& textures, const std::vector<Model>& models, const std::vector<glm::mat4>& matrix) {
     glBindVertexArray(0); // debind sphere
     glBindVertexArray(models[2].vao); // bind ring
-    float size = planet.size + Planet::ringSize;
+    float size = snapshot.sizes[i] + Planet::ringSize;
     double time = info.getTime();
-    glm::mat4 ringMVMatrix = glm::translate(matrix[1], planet.position);
-    ringMVMatrix = glm::rotate(ringMVMatrix, planet.obliquity, glm::vec3(1, 0, 0));
-    ringMVMatrix = glm::rotate(ringMVMatrix, float(time * (planet.rotationSpeed * info.getFactorSpeed())), planet.inclination);
+    glm::mat4 ringMVMatrix = glm::translate(matrix[1], position);
+    ringMVMatrix = glm::rotate(ringMVMatrix, snapshot.obliquities[i], glm::vec3(1, 0, 0));
+    ringMVMatrix = glm::rotate(ringMVMatrix, float(time * (snapshot.rotationSpeeds[i] * info.getFactorSpeed())), snapshot.inclinations[i]);
     ringMVMatrix = glm::scale(ringMVMatrix, glm::vec3(size, size, size));
-    prepareTextures(planet.textureIdx+28, program->u, textures); // +28 in the global order to get the ring texture of the asked planet
-    fillUniforms(program->u, ringMVMatrix, matrix, planet.visibility);
+    prepareTextures(snapshot.textureIdxs[i]+28, program->u, textures); // +28 in the global order to get the ring texture of the asked planet
+    fillUniforms(program->u, ringMVMatrix, matrix, snapshot.visibilities[i]);
     glDrawArrays(GL_TRIANGLES, 0, models[2].vertexCount);
     glBindVertexArray(0); // debind ring
     glBindVertexArray(models[0].vao); // bind sphere
@@ -196,136 +172,45 @@ void drawRing(Planet planet, PlanetProgram* program, Info info, std::vector<GLui
 //     glDrawArrays(GL_TRIANGLES, 0, models[0].vertexCount);
 // }
 
-// Draw the asked explosion
-void drawExplosion(Planet explosion, PlanetProgram* program, std::vector<GLuint> textures, std::vector<Model> models, std::vector<glm::mat4> matrix) {
-    float size = explosion.size;
-    glm::mat4 explosionMVMatrix = glm::translate(matrix[1], explosion.position);
-    explosionMVMatrix = glm::scale(explosionMVMatrix, glm::vec3(size, size, size));
-    prepareTextures(explosion.textureIdx, program->u, textures);
-    fillUniforms(program->u, explosionMVMatrix, matrix, 1.0);
-    glDrawArrays(GL_TRIANGLES, 0, models[0].vertexCount);
+// Draw every explosion particles, interpolated between the last two steps
+void drawExplosions(const Snapshot& snapshot, float alpha, PlanetProgram* program, const std::vector<GLuint>& textures, const std::vector<Model>& models, const std::vector<glm::mat4>& matrix) {
+    if(snapshot.nbExplosions() == 0) return;
+    prepareTextures(37, program->u, textures); // particles are white (index 37)
+    const glm::vec4* previous = snapshot.particlePrevious.data();
+    const glm::vec4* particles = snapshot.particles.data();
+    for(size_t i=0; i<snapshot.nbExplosions(); i++) {
+        glm::vec4 particle = glm::mix(previous[i], particles[i], alpha); // x, y, z, size
+        glm::mat4 explosionMVMatrix = glm::translate(matrix[1], glm::vec3(particle));
+        explosionMVMatrix = glm::scale(explosionMVMatrix, glm::vec3(particle.w, particle.w, particle.w));
+        fillUniforms(program->u, explosionMVMatrix, matrix, 1.0);
+        glDrawArrays(GL_TRIANGLES, 0, models[0].vertexCount);
+    }
 }
 
 // Draw the n.i asked planet
-void drawPlanet(Planet planet, PlanetProgram* program, Info info, std::vector<GLuint> textures, std::vector<Model> models, std::vector<glm::mat4> matrix) {
-    float size = planet.size;
+void drawPlanet(const Snapshot& snapshot, size_t i, glm::vec3 position, PlanetProgram* program, const Info& info, const std::vector<GLuint>& textures, const std::vector<Model>& models, const std::vector<glm::mat4>& matrix) {
+    float size = snapshot.sizes[i];
     double time = info.getTime();
-    glm::mat4 planetMVMatrix = glm::translate(matrix[1], planet.position);
-    planetMVMatrix = glm::rotate(planetMVMatrix, planet.obliquity, glm::vec3(1, 0, 0));
-    planetMVMatrix = glm::rotate(planetMVMatrix, float(time * (planet.rotationSpeed * info.getFactorSpeed())), planet.inclination);
+    glm::mat4 planetMVMatrix = glm::translate(matrix[1], position);
+    planetMVMatrix = glm::rotate(planetMVMatrix, snapshot.obliquities[i], glm::vec3(1, 0, 0));
+    planetMVMatrix = glm::rotate(planetMVMatrix, float(time * (snapshot.rotationSpeeds[i] * info.getFactorSpeed())), snapshot.inclinations[i]);
     planetMVMatrix = glm::scale(planetMVMatrix, glm::vec3(size, size, size));
-    prepareTextures(planet.textureIdx, program->u, textures);
-    fillUniforms(program->u, planetMVMatrix, matrix, planet.visibility);
+    prepareTextures(snapshot.textureIdxs[i], program->u, textures);
+    fillUniforms(program->u, planetMVMatrix, matrix, snapshot.visibilities[i]);
     glDrawArrays(GL_TRIANGLES, 0, models[0].vertexCount);
-    if(planet.textureIdx == 6 || planet.textureIdx == 7) drawRing(planet, program, info, textures, models, matrix); // draw ring if applicable
+    if(snapshot.textureIdxs[i] == 6 || snapshot.textureIdxs[i] == 7) drawRing(snapshot, i, position, program, info, textures, models, matrix); // draw ring if applicable
 }
 
 
-void drawEverything(std::vector<Planet> planets, std::vector<Planet> explosions, PlanetProgram* program,
-                    Info info, std::vector<GLuint> textures, std::vector<Model> models, std::vector<glm::mat4> matrix) {
+void drawEverything(const Snapshot& snapshot, float alpha, PlanetProgram* program,
+                    const Info& info, const std::vector<GLuint>& textures, const std::vector<Model>& models, const std::vector<glm::mat4>& matrix) {
     program->m_Program.use();
     glBindVertexArray(models[0].vao); // bind sphere
     drawSkybox(program, textures, models, matrix);
     if(info.drawHitbox()) drawHitbox(program, textures, models, matrix);
-    for(size_t i=0; i<planets.size(); i++) {
-        drawPlanet(planets[i], program, info, textures, models, matrix);
-    }
-    for(size_t i=0; i<explosions.size(); i++) {
-        drawExplosion(explosions[i], program, textures, models, matrix);
+    for(size_t i=0; i<snapshot.nbPlanets(); i++) { // drawn between the last two steps
+        drawPlanet(snapshot, i, glm::mix(snapshot.previous[i], snapshot.positions[i], alpha), program, info, textures, models, matrix);
     }
+    drawExplosions(snapshot, alpha, program, textures, models, matrix);
     glBindVertexArray(0); // debind sphere
 }
-
-
-// ============================================================
-// UPDATE FUNCTIONS
-// ============================================================
-
-void updateEverything(std::vector<Planet>* planets, std::vector<Planet>* explosions, Info* info) {
-    std::set<int> collideSet;
-    for(size_t i=0; i<planets->size(); i++) {
-        Planet& planet = planets->operator[](i);
-        // MOVEMENT
-        if(glm::length(planet.position) > float(Planet::distanceMax)) { // hitbox verif
-            planet.direction = -1.0f * planet.direction;
-            planet.inclination = -1.0f * planet.inclination;
-        }
-        else if(planet.dirUpdateNb % Planet::dirUpdateRate == 0) { // chance of changing direction
-            planet.direction = glm::normalize(glm::sphericalRand(1.0f));
-            planet.dirUpdateNb = 0;
-        }
-        planet.position += planet.direction;
-        planet.dirUpdateNb++;
-        // COLLISION DETECTION
-        if(!planet.hasLoaded || collideSet.find(i) != collideSet.end()) continue; // skip collision if not loaded
-        for(size_t j=0; j<planets->size(); j++) {
-            if(i == j || collideSet.find(j) != collideSet.end()) continue; // can't collide with itself
-            Planet& other = planets->operator[](j);
-            if(!other.hasLoaded) continue; // skip collision if not loaded
-            if(planet.hasCollided(other)) { // collision detected
-                std::cout << "Collision! (" << i << ", " << j << ")" << std::endl;
-                if((planet.size > Planet::minC && other.size > Planet::minC) || (planet.size <= Planet::minC && other.size <= Planet::minC)) {
-                    collideSet.insert(i);
-                    collideSet.insert(j);
-                }
-                else collideSet.insert((planet.size <= Planet::minC ? i : j)); // special collision if very small planet collide with big planet
-                // planets->operator[]((destroyed == i) ? j : i).size *= 1.5;
-            }
-        }
-    }
-    // COLLISION RESULT
-    int nbC = 0; int sizeC = 0; glm::vec3 posC;
-    for(auto i = collideSet.rbegin(); i != collideSet.rend(); i++) {
-        auto planet = planets->begin() + *i; // get collided planet
-        if(planet->size > Planet::minC) { // generate new data if the planet is not too small
-            if(planet->size > sizeC) sizeC = planet->size;
-            posC = planet->position; nbC++; }
-        addExplosion(explosions, info->getTime(), planet->size, planet->position); // add explosion
-        planets->erase(planet); // remove collided planet
-        if(nbC == 2) { // create new data for every collision of not too small planets (2 planets in collision)
-            float s = float(sizeC) / 2.0;
-            nbC = 0; sizeC = 0;
-            if(s < Planet::minC) continue; // only accept not too small planets
-            int NB = Planet::selectExplodingFragments();
-            for(int n=0; n<NB; n++) { // create new planets (exploding fragments)
-                planets->push_back(createPlanet(info->getTime(), s, posC));
-            }
-        }
-    }
-    // EXPLOSION EFFECTS
-    bool fRem = false;
-    for(size_t i=0; i<explosions->size(); i++) { // explosion particles movement + getting smaller
-        explosions->operator[](i).position += explosions->operator[](i).direction * Planet::explosionSpeed;
-        explosions->operator[](i).size /= Planet::explosionRate;
-        if(!fRem && explosions->operator[](i).size <= Planet::explosionMinSize) fRem = true;
-    }
-    if(fRem) explosions->erase(std::remove_if(explosions->begin(), explosions->end(), // remove small explosions
-                [](const Planet& e) {return e.size <= Planet::explosionMinSize;}), explosions->end());
-    // SPECIAL EVENTS
-    if(info->specialSpawn()) { // spawn a new planet
-        std::cout << "Spawning a new planet!" << std::endl;
-        planets->push_back(createPlanet(info->getTime()));
-        info->modifySpecialSpawn(); }
-    if(info->specialClean()) { // delete all small planets
-        std::cout << "Deleting all small planets." << std::endl;
-        planets->erase(std::remove_if(planets->begin(), planets->end(),
-            [](const Planet& p) {return p.size <= Planet::minC;}), planets->end());
-        info->modifySpecialClean();
-    }
-}
-
-
-void updateVisibility(std::vector<Planet>* planets, Info info) {
-    for(size_t i=0; i<planets->size(); i++) {
-        Planet& planet = planets->operator[](i);
-        if(planet.hasLoaded) continue; // skip loaded planets
-        if(planet.durationOfLoad - planet.spawnTime >= planet.loadPeriod) { // load finish
-            planet.hasLoaded = true;
-            planet.visibility = 1.0;
-            continue;}
-        else planet.durationOfLoad = info.getTime(); // load not finish
-        if(planet.visibility >= 1.0) planet.visibilityOp = -0.1;
-        if(planet.visibility <= 0.1) planet.visibilityOp = 0.1;
-        planet.visibility += planet.visibilityOp; // flashing effect when not loaded (modify visibility)
-    }
-}
\ No newline at end of file
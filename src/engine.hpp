@@ -15,10 +15,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <vector>
-#include <set>
 
 #include "camera.hpp"
 #include "planets.hpp"
+#include <simucore/SimulationThread.hpp>
 
 
 /* structure used to represent a 3D model (vbo + vao + vertexCount) */
@@ -55,22 +55,13 @@ std::vector<Model> createModels(bool lowConfig);
  * @return a pointer in memory to the allocated data of VBO or VAO */
 GLuint* getDataOfModels(std::vector<Model> models, int type);
 
-/**Create the initial planet vector*/
-std::vector<Planet> createAllPlanets(int nb, double actualTime);
-
 /** Draw every objects for the simulation
- * @param planets vector containing every planets
- * @param explosions vector containing every explosions (particles)
+ * @param snapshot planets and explosions (particles) published by the simulation thread
+ * @param alpha fraction of the next simulation step already elapsed, the planets are drawn between the last two steps
  * @param planet opengl program structure of planets
  * @param info Info structure containing various data, including time
  * @param textures vector containing every pre-loaded textures
  * @param models vector containing every pre-loaded models (sphere, circle, ...)
  * @param matrix vector containing the ProjMatrix, globalMVMatrix and viewMatrix */
-void drawEverything(std::vector<Planet> planets, std::vector<Planet> explosions, PlanetProgram* planet,
-    Info info, std::vector<GLuint> textures, std::vector<Model> models, std::vector<glm::mat4> matrix);
-
-/**Update every planets parameters*/
-void updateEverything(std::vector<Planet>* planets, std::vector<Planet>* explosions, Info* info);
-
-/**Update the visibility (brightness) of planets when they are not loaded*/
-void updateVisibility(std::vector<Planet>* planets, Info info);
\ No newline at end of file
+void drawEverything(const Snapshot& snapshot, float alpha, PlanetProgram* planet,
+    const Info& info, const std::vector<GLuint>& textures, const std::vector<Model>& models, const std::vector<glm::mat4>& matrix);
@@ -15,7 +15,16 @@ int NB_PLANETS = 5; // initial number of planets
 void simucollision(GLFWwindow* window, glimac::FilePath applicationPath);
 
 /* The Info class contains time and various data */
-Info info;
+GlfwClock glfwClock;
+Info info(&glfwClock);
+
+/* The simulation runs on its own thread, inputs are sent to it */
+SimulationThread* simulation = nullptr;
+
+/* Send the actual speed (or pause) to the simulation thread */
+static void sendTimeScale() {
+    if(simulation) simulation->setTimeScale(info.isPaused() ? 0.0 : info.getTimeScale());
+}
 
 
 // ============================================================
@@ -34,11 +43,11 @@ static void key_callback(GLFWwindow* window, int key, int /*scancode*/, int acti
             case GLFW_KEY_S: camera.moveFront(1.0); break;
             case GLFW_KEY_D: camera.moveLeft(-1.0); break;
             case GLFW_KEY_T: camera.switchType(); break;
-            case GLFW_KEY_KP_SUBTRACT: info.modifySpeed(-100.0); break;
-            case GLFW_KEY_KP_ADD: info.modifySpeed(100.0); break;
-            case GLFW_KEY_KP_0: info.modifySpecialSpawn(); break;
-            case GLFW_KEY_KP_1: info.modifySpecialClean(); break;
-            case GLFW_KEY_SPACE: info.pauseTime(); break;
+            case GLFW_KEY_KP_SUBTRACT: info.modifySpeed(-100.0); sendTimeScale(); break;
+            case GLFW_KEY_KP_ADD: info.modifySpeed(100.0); sendTimeScale(); break;
+            case GLFW_KEY_KP_0: if(simulation) simulation->requestSpawn(); break;
+            case GLFW_KEY_KP_1: if(simulation) simulation->requestClean(); break;
+            case GLFW_KEY_SPACE: info.pauseTime(); sendTimeScale(); break;
             case GLFW_KEY_ESCAPE: glfwSetWindowShouldClose(window, 1); break;
             default: break;
         }
@@ -104,7 +113,7 @@ int main(int argc, char** argv) {
     glfwSetCursorPosCallback(window, &cursor_position_callback);
     glfwSetWindowSizeCallback(window, &size_callback);
 
-    std::srand(time(0));
+    Random::setSeed(time(0));
     glEnable(GL_DEPTH_TEST);
     std::cout << "Launching... " << argc << " " << argv << std::endl;
     std::cout << "OpenGL Version : " << glGetString(GL_VERSION) << std::endl;
@@ -124,9 +133,10 @@ void simucollision(GLFWwindow* window, glimac::FilePath applicationPath) {
     
     std::vector<GLuint> textureObjects = createTextureObjects(applicationPath.dirPath());
     std::vector<Model> models = createModels(lowConfig);
-    std::vector<Planet> planets = createAllPlanets(NB_PLANETS, info.getTime());
-    std::vector<Planet> explosions; // explosions are planets but with special interactions
-    unsigned int loopIdx = 0; // control update rate of planets
+    SimulationThread simulationThread(NB_PLANETS); // planets, explosions and the update loop
+    simulation = &simulationThread;
+    sendTimeScale();
+    simulationThread.start();
 
     while (!glfwWindowShouldClose(window)) { // main loop
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -137,19 +147,16 @@ void simucollision(GLFWwindow* window, glimac::FilePath applicationPath) {
         matrix[2] = camera.getViewMatrix();
         matrix[1] = camera.getGlobalMVMatrix(modelMatrix);
 
-        drawEverything(planets, explosions, &program, info, textureObjects, models, matrix); // main draw func
-        if(loopIdx % info.getUpdateRate() == 0) updateVisibility(&planets, info); // visibility update func
-        if(!info.isPaused() && loopIdx % info.getUpdateRate() == 0) {
-            updateEverything(&planets, &explosions, &info); // main update func
-            loopIdx = 0;
-        }
+        const Snapshot& snapshot = simulationThread.latest(); // last state published by the simulation thread
+        drawEverything(snapshot, snapshot.alphaAt(simulationThread.now()), &program, info, textureObjects, models, matrix); // main draw func
         
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, 0);
         glfwSwapBuffers(window); // Update the display
         glfwPollEvents(); // Poll for and process events
-        loopIdx++;
     }
+    simulationThread.stop();
+    simulation = nullptr;
 
     glDeleteTextures(textureObjects.size(), textureObjects.data());
     glDeleteBuffers(models.size(), getDataOfModels(models, 0));
@@ -0,0 +1,81 @@
+#include <c3ga/KVector.hpp>
+#include <iostream>
+#include <random>
+
+#include "checkTools.hpp"
+
+
+/* Check that the k-vectors of KVector.hpp convert exactly from and to Mvec, grade by grade, that their products give
+ * the coefficients of the Mvec products, and that the products between k-vectors are evaluated at compile time */
+
+const int NB_CASES = 1000; // random pairs of multivectors
+
+// the products only call constexpr explicit functions: e1 ^ e2 = e12, e12 . e2 = e1, e0 . ei = -1, e1 ^ e1 = 0
+constexpr c3ga::Vec1<double> e0(1.0, 0.0, 0.0, 0.0, 0.0), e1(0.0, 1.0, 0.0, 0.0, 0.0), e2(0.0, 0.0, 1.0, 0.0, 0.0), ei(0.0, 0.0, 0.0, 0.0, 1.0);
+constexpr c3ga::Vec2<double> e12 = e1 ^ e2;
+static_assert(e12[c3ga::E12] == 1.0 && e12[c3ga::E01] == 0.0 && e12[c3ga::E2i] == 0.0, "constexpr outer product");
+static_assert((e12 | e2) == e1, "constexpr inner product of an outer product");
+static_assert(double(e0 | ei) == -1.0 && (e1 ^ e1) == c3ga::Vec2<double>(), "constexpr products of the null basis");
+
+/* Random multivector of every grade, integer coefficients in [-3,3] so the products are exact */
+c3ga::Mvec<double> randomMvec() {
+    return randomMvec(63, []{ return double(int(generator() % 7) - 3); });
+}
+
+/* Same grades and same coefficients (-0 and +0 are the same) */
+bool same(const c3ga::Mvec<double>& mv1, const c3ga::Mvec<double>& mv2) {
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++) {
+        if(mv1.isGrade(grade) != mv2.isGrade(grade)) return false;
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            if(mv1.at(grade, i) != mv2.at(grade, i)) return false;
+    }
+    return true;
+}
+
+/* Round trip of the grade K of a multivector: toMvec gives only that grade, with its coefficients, and back */
+template<unsigned int K>
+void checkRoundTrip(const c3ga::Mvec<double>& mv, int n) {
+    const c3ga::KVector<double, K> kvector(mv);
+    const c3ga::Mvec<double> converted = kvector.toMvec();
+    bool exact = converted.isGrade(K);
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            exact = exact && converted.at(grade, i) == (grade == K ? mv.at(grade, i) : 0.0);
+    check(exact && c3ga::KVector<double, K>(converted) == kvector, "KVector(mv).toMvec()", n);
+}
+
+/* Products of the grades Grade1 and Grade2 of two multivectors, as k-vectors and as Mvec (whose empty grades are read as 0) */
+template<unsigned int Grade1, unsigned int Grade2>
+void checkProducts(const c3ga::Mvec<double>& mv1, const c3ga::Mvec<double>& mv2, int n) {
+    constexpr unsigned int gradeInner = (Grade1 > Grade2 ? Grade1 - Grade2 : Grade2 - Grade1);
+    const c3ga::KVector<double, Grade1> kvector1(mv1);
+    const c3ga::KVector<double, Grade2> kvector2(mv2);
+    const c3ga::Mvec<double> part1 = mv1.grade(Grade1), part2 = mv2.grade(Grade2);
+    if constexpr(Grade1 + Grade2 <= c3ga::algebraDimension)
+        check((kvector1 ^ kvector2) == c3ga::KVector<double, Grade1 + Grade2>(part1 ^ part2), "outer product of k-vectors", n);
+    check((kvector1 | kvector2) == c3ga::KVector<double, gradeInner>(part1 | part2), "inner product of k-vectors", n);
+    check((kvector1 < kvector2) == c3ga::KVector<double, gradeInner>(part1 < part2), "left contraction of k-vectors", n);
+    check((kvector1 > kvector2) == c3ga::KVector<double, gradeInner>(part1 > part2), "right contraction of k-vectors", n);
+    check(same(kvector1 * kvector2, part1 * part2), "geometric product of k-vectors", n);
+    if constexpr(Grade2 < c3ga::algebraDimension) checkProducts<Grade1, Grade2 + 1>(mv1, mv2, n);
+    else if constexpr(Grade1 < c3ga::algebraDimension) checkProducts<Grade1 + 1, 0>(mv1, mv2, n);
+}
+
+
+int main() {
+    generator.seed(26);
+    for(int n=0; n<NB_CASES; n++) {
+        const c3ga::Mvec<double> mv1 = randomMvec(), mv2 = randomMvec();
+        checkRoundTrip<0>(mv1, n);
+        checkRoundTrip<1>(mv1, n);
+        checkRoundTrip<2>(mv1, n);
+        checkRoundTrip<3>(mv1, n);
+        checkRoundTrip<4>(mv1, n);
+        checkRoundTrip<5>(mv1, n);
+        checkProducts<0, 0>(mv1, mv2, n);
+    }
+
+    if(reportFailures()) return 1;
+    std::cout << "c3ga KVector: every grade converts exactly and every product of k-vectors gives the Mvec product" << std::endl;
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <c3ga/Lazy.hpp>
+#include <iostream>
+#include <random>
+
+#include "checkTools.hpp"
+
+
+/* Check that the lazy expressions of c3ga give the values of the Mvec operators, and evaluate each grade of their operands once */
+
+const int NB_CASES = 3000; // random triplets of multivectors
+
+std::uniform_real_distribution<double> coefficient(-2.0, 2.0);
+
+/* Random multivector of the given grades */
+c3ga::Mvec<double> randomMvec(unsigned int grades) {
+    return randomMvec(grades, []{ return coefficient(generator); });
+}
+
+/* Same multivector without the grades whose coefficients are all zero, as the lazy evaluation gives */
+c3ga::Mvec<double> withoutZeroGrades(c3ga::Mvec<double> mv) {
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        mv.removeGradeIfZero(grade);
+    return mv;
+}
+
+/* Lazy multivector counting the evaluations of its grades */
+class CountedMvec : public c3ga::LazyExpr<double, CountedMvec> {
+    c3ga::LazyMvec<double> mv;
+    int* nbEvaluations;
+
+public:
+    CountedMvec(const c3ga::Mvec<double>& mv, int* nbEvaluations) : mv(mv), nbEvaluations(nbEvaluations) {}
+    unsigned int grades() const { return mv.grades(); }
+    c3ga::ConstKvecRef<double> evalGrade(const unsigned int grade, double* buffer) const { (*nbEvaluations)++; return mv.evalGrade(grade, buffer); }
+    bool sameAs(const CountedMvec& other) const { return mv.sameAs(other.mv); }
+};
+
+
+int main() {
+    generator.seed(17);
+    std::uniform_int_distribution<unsigned int> grades(0, 63), grade(0, 5);
+    for(int n=0; n<NB_CASES; n++) {
+        const c3ga::Mvec<double> mv1 = randomMvec(grades(generator)), mv2 = randomMvec(grades(generator)), mv3 = randomMvec(grades(generator));
+        const unsigned int k = grade(generator);
+
+        check((c3ga::lazy(mv1) ^ c3ga::lazy(mv2)).eval() == withoutZeroGrades(mv1 ^ mv2), "outer product", n);
+        check((c3ga::lazy(mv1) | c3ga::lazy(mv2)).eval() == withoutZeroGrades(mv1 | mv2), "inner product", n);
+        check((!c3ga::lazy(mv1)).eval() == withoutZeroGrades(!mv1), "dual", n);
+        check(((!c3ga::lazy(mv1) ^ !c3ga::lazy(mv2)) | c3ga::lazy(mv3).grade(k)).eval() == withoutZeroGrades(((!mv1) ^ (!mv2)) | mv3.grade(k)), "nested expression", n);
+
+        const c3ga::Mvec<double> meet = mv1 ^ mv2;
+        const auto lazyMeet = c3ga::lazy(mv1) ^ c3ga::lazy(mv2);
+        check((lazyMeet | lazyMeet).scalar() == double(c3ga::Mvec<double>(meet | meet)), "squared meet", n);
+        check((lazyMeet | (c3ga::lazy(mv2) ^ c3ga::lazy(mv1))).eval() == withoutZeroGrades(meet | (mv2 ^ mv1)), "inner product of different meets", n);
+    }
+
+    // (circle | circle) of two dual spheres evaluates the grade 1 of each sphere once, the circle being the same on both sides
+    const c3ga::Mvec<double> dualSphere1 = randomMvec(2), dualSphere2 = randomMvec(2);
+    int nbEvaluations1 = 0, nbEvaluations2 = 0;
+    const auto circle = CountedMvec(dualSphere1, &nbEvaluations1) ^ CountedMvec(dualSphere2, &nbEvaluations2);
+    const c3ga::Mvec<double> circleMvec = dualSphere1 ^ dualSphere2;
+    check((circle | circle).scalar() == double(c3ga::Mvec<double>(circleMvec | circleMvec)), "squared circle");
+    check(nbEvaluations1 == 1 && nbEvaluations2 == 1, "single evaluation of the spheres of a squared circle");
+
+    // a grade of mv2 reachable from two grades of mv1 is evaluated once
+    const c3ga::Mvec<double> mv1 = randomMvec(0b1010), mv2 = randomMvec(0b0100);
+    nbEvaluations1 = nbEvaluations2 = 0;
+    c3ga::Mvec<double> inner = (CountedMvec(mv1, &nbEvaluations1) | CountedMvec(mv2, &nbEvaluations2)).eval(); // grade 1, from the grades 1 and 3 of mv1
+    check(inner == withoutZeroGrades(mv1 | mv2), "inner product of counted multivectors");
+    check(nbEvaluations1 == 2 && nbEvaluations2 == 1, "single evaluation of the operands of an inner product");
+
+    if(reportFailures()) return 1;
+    std::cout << "c3ga lazy expressions: every result matches Mvec" << std::endl;
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <c3ga/Mvec.hpp>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "checkTools.hpp"
+
+
+/* Differential check of the inline storage of c3ga::Mvec against the former storage (a std::list of Eigen::VectorXd, one per grade).
+ * Every operation is run on random multivectors and its results (grades, coefficients and printing) are summed up in a digest.
+ * The expected digests were computed with the list version of Mvec.hpp, the same file built against another version of the lib
+ * prints its own digests with --print.
+ * The coefficients are small integers, so every operation but the inverse is exact and the digests do not depend on the
+ * compiler or on the processor, and the inverse is a single division of the reverse by its scalar norm. */
+
+const int NB_CASES = 3000; // random pairs of multivectors
+
+/* Digest of the results of an operation, multivectors and printings */
+struct MvecDigest : public Digest {
+    using Digest::add;
+
+    void add(const c3ga::Mvec<double>& mv) {
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++) {
+            const unsigned char contained = mv.isGrade(grade);
+            add(&contained, 1);
+            if(!contained) continue;
+            for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++) {
+                const double coefficient = mv.at(grade, i) + 0.0; // same digest for -0 and +0
+                uint64_t bits;
+                std::memcpy(&bits, &coefficient, sizeof(bits));
+                add(&bits, sizeof(bits));
+            }
+        }
+    }
+
+    void add(const std::string& text) {
+        add(text.data(), text.size());
+    }
+};
+
+/* Same grades and same coefficients (-0 and +0 are the same) */
+bool same(const c3ga::Mvec<double>& mv1, const c3ga::Mvec<double>& mv2) {
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++) {
+        if(mv1.isGrade(grade) != mv2.isGrade(grade)) return false;
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            if(mv1.at(grade, i) != mv2.at(grade, i)) return false;
+    }
+    return true;
+}
+
+/* The parts of the geometric product computed alone, by productGrade<K> for K from Grade to the dimension of the algebra,
+ * are the grades of the whole product */
+template<unsigned int Grade>
+void checkProductGrades(const c3ga::Mvec<double>& mv1, const c3ga::Mvec<double>& mv2, const c3ga::Mvec<double>& product, int n) {
+    check(same(c3ga::productGrade<Grade>(mv1, mv2), product.grade(Grade)), "productGrade<K>", n);
+    if constexpr(Grade < c3ga::algebraDimension) checkProductGrades<Grade + 1>(mv1, mv2, product, n);
+}
+
+/* Random multivector: random grades, integer coefficients in [-3,3] (a grade can be contained with only zeros) */
+c3ga::Mvec<double> randomMvec() {
+    const unsigned int grades = generator() % 64;
+    return randomMvec(grades, []{ return double(int(generator() % 7) - 3); });
+}
+
+enum Operation { SUM, DIFFERENCE, OUTER, INNER, LEFT_CONTRACTION, RIGHT_CONTRACTION, GEOMETRIC, SCALAR, DUAL, REVERSE, INVERSE, GRADE, PRINTING, NB_OPERATIONS };
+const char* operationNames[NB_OPERATIONS] = {"sum", "difference", "outer product", "inner product", "left contraction", "right contraction",
+                                             "geometric product", "scalar products", "dual", "reverse", "inverse", "grade extraction", "printing"};
+
+/* Digests computed with the list version of Mvec */
+const uint64_t expectedDigests[NB_OPERATIONS] = {
+    0x3ca92fc60a27b5c2ull, // sum
+    0x705b4a6b49957b5eull, // difference
+    0x9577e0990aa5b398ull, // outer product
+    0xcddccef5a117f070ull, // inner product
+    0xd1f64e7f09830f6cull, // left contraction
+    0x14a1ce9d6aac6ef1ull, // right contraction
+    0x6632573883badfc9ull, // geometric product
+    0x117be673cca09629ull, // scalar products
+    0x556b72d86b46557dull, // dual
+    0x221f91bf2c9a40dfull, // reverse
+    0x12f7b427f822549dull, // inverse
+    0x41aa247ac33ccf0full, // grade extraction
+    0xd9ace9004c54afceull  // printing
+};
+
+
+int main(int argc, char** argv) {
+    generator.seed(13);
+    MvecDigest digests[NB_OPERATIONS];
+    for(int n=0; n<NB_CASES; n++) {
+        const c3ga::Mvec<double> mv1 = randomMvec();
+        const c3ga::Mvec<double> mv2 = randomMvec();
+
+        digests[SUM].add(mv1 + mv2);
+        digests[DIFFERENCE].add(mv1 - mv2);
+        digests[OUTER].add(mv1 ^ mv2);
+        digests[INNER].add(mv1 | mv2);
+        digests[LEFT_CONTRACTION].add(mv1 < mv2);
+        digests[RIGHT_CONTRACTION].add(mv1 > mv2);
+        digests[GEOMETRIC].add(mv1 * mv2);
+        digests[SCALAR].add(mv1 * 2.0);
+        digests[SCALAR].add(mv1 + 1.0);
+        digests[SCALAR].add(mv1 ^ 3.0);
+        digests[DUAL].add(mv1.dual());
+        digests[REVERSE].add(mv1.reverse());
+        digests[INVERSE].add(mv1.inv());
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+            digests[GRADE].add(mv1.grade(grade));
+
+        std::ostringstream text;
+        text << mv1 << ";" << (mv1 * mv2) << ";" << mv1.dual();
+        digests[PRINTING].add(text.str());
+
+        // the parts of the geometric product computed alone (not in the digests, they are newer than the list version)
+        const c3ga::Mvec<double> product = mv1 * mv2;
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+            check(same(mv1.productGrade(grade, mv2), product.grade(grade)), "productGrade", n);
+        checkProductGrades<0>(mv1, mv2, product, n);
+        check(mv1.productScalar(mv2) == product.at(0, 0), "productScalar", n);
+
+        // the functions writing in an output multivector, when the output is an operand or holds a former result
+        const c3ga::Mvec<double> outer = mv1 ^ mv2, inner = mv1 | mv2, dual = mv1.dual();
+        c3ga::Mvec<double> mv = mv2;
+        c3ga::outer(mv, mv1, mv); check(same(mv, outer), "outer(mv2, mv1, mv2)", n);
+        mv = mv1; c3ga::outer(mv, mv, mv2); check(same(mv, outer), "outer(mv1, mv1, mv2)", n);
+        mv = mv2; c3ga::inner(mv, mv1, mv); check(same(mv, inner), "inner(mv2, mv1, mv2)", n);
+        mv = mv1; c3ga::inner(mv, mv, mv2); check(same(mv, inner), "inner(mv1, mv1, mv2)", n);
+        mv = mv2; c3ga::geometric(mv, mv1, mv); check(same(mv, product), "geometric(mv2, mv1, mv2)", n);
+        mv = mv1; c3ga::geometric(mv, mv, mv2); check(same(mv, product), "geometric(mv1, mv1, mv2)", n);
+        mv = mv1; c3ga::dual(mv, mv); check(same(mv, dual), "dual(mv1, mv1)", n);
+        mv = mv1; mv ^= mv2; check(same(mv, outer), "mv1 ^= mv2", n);
+        mv = mv1; mv |= mv2; check(same(mv, inner), "mv1 |= mv2", n);
+        mv = mv1; mv *= mv2; check(same(mv, product), "mv1 *= mv2", n);
+        mv = mv1; mv *= mv; check(same(mv, mv1 * mv1), "mv1 *= mv1", n);
+        c3ga::Mvec<double> reused = mv1 + 1.0; // never empty, then it holds the result of the former function
+        c3ga::outer(reused, mv1, mv2); check(same(reused, outer), "outer in a reused multivector", n);
+        c3ga::inner(reused, mv1, mv2); check(same(reused, inner), "inner in a reused multivector", n);
+        c3ga::geometric(reused, mv1, mv2); check(same(reused, product), "geometric in a reused multivector", n);
+        c3ga::dual(reused, mv1); check(same(reused, dual), "dual in a reused multivector", n);
+    }
+
+    if(argc > 1 && std::strcmp(argv[1], "--print") == 0) {
+        for(int operation=0; operation<NB_OPERATIONS; operation++)
+            std::cout << "0x" << std::hex << digests[operation].value << "ull, // " << operationNames[operation] << std::endl;
+        return 0;
+    }
+
+    for(int operation=0; operation<NB_OPERATIONS; operation++)
+        check(digests[operation].value == expectedDigests[operation], operationNames[operation]);
+    if(reportFailures()) return 1;
+    std::cout << "c3ga Mvec storage: every operation gives the results of the list version" << std::endl;
+    return 0;
+}
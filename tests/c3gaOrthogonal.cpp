@@ -0,0 +1,95 @@
+#include <c3ga/Orthogonal.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "checkTools.hpp"
+
+
+/* Check that the products of OrthogonalMvec (orthogonal basis e+, e1, e2, e3, e-) give the values of the Mvec products */
+
+const int NB_CASES = 3000; // random pairs of multivectors
+const double TOLERANCE = 2e-15; // relative to the largest coefficient of the product of the absolute values of the operands
+const double FLOAT_TOLERANCE = 1e-6; // same in float
+
+std::uniform_real_distribution<double> coefficient(-2.0, 2.0);
+
+double maxError = 0.0;
+
+/* Random multivector of random grades */
+c3ga::Mvec<double> randomMvec() {
+    const unsigned int grades = 1 + generator() % 63;
+    return randomMvec(grades, []{ return coefficient(generator); });
+}
+
+/* Same multivector with the absolute values of its coefficients */
+c3ga::Mvec<double> absoluteValues(c3ga::Mvec<double> mv) {
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            if(mv.isGrade(grade)) mv.at(grade, i) = std::fabs(mv.at(grade, i));
+    return mv;
+}
+
+/* Compare a result with its Mvec version, the error is relative to the given magnitude of the coefficients (at least 1) */
+void check(const c3ga::OrthogonalMvec<double>& mv, const c3ga::Mvec<double>& reference, double magnitude, const char* what, int n) {
+    const c3ga::Mvec<double> result = mv.toMvec();
+    double error = 0.0;
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            error = std::max(error, std::fabs(result.at(grade, i) - reference.at(grade, i)));
+    error /= std::max(1.0, magnitude);
+    maxError = std::max(maxError, error);
+    check(error < TOLERANCE, what, n);
+}
+
+/* Largest coefficient of a multivector */
+double largestCoefficient(const c3ga::Mvec<double>& mv) {
+    double magnitude = 0.0;
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            magnitude = std::max(magnitude, std::fabs(mv.at(grade, i)));
+    return magnitude;
+}
+
+
+int main() {
+    generator.seed(22);
+    for(int n=0; n<NB_CASES; n++) {
+        const c3ga::Mvec<double> mv1 = randomMvec(), mv2 = randomMvec();
+        const c3ga::OrthogonalMvec<double> orthogonal1(mv1), orthogonal2(mv2);
+
+        // the products of the absolute values bound the magnitude of the terms summed by the products
+        const double magnitude = largestCoefficient(absoluteValues(mv1) * absoluteValues(mv2));
+
+        check(orthogonal1, mv1, largestCoefficient(mv1), "round trip", n);
+        check(orthogonal1 * orthogonal2, mv1 * mv2, magnitude, "geometric product", n);
+        check(orthogonal1 ^ orthogonal2, mv1 ^ mv2, magnitude, "outer product", n);
+        check(orthogonal1 | orthogonal2, mv1 | mv2, magnitude, "inner product", n);
+        check(orthogonal1.reverse(), mv1.reverse(), largestCoefficient(mv1), "reverse", n);
+        check(orthogonal1 + orthogonal2 * 2.0 - orthogonal1.reverse(), mv1 + mv2 * 2.0 - mv1.reverse(), magnitude, "sum", n);
+    }
+
+    // in float, the same products within the float rounding errors
+    for(int n=0; n<NB_CASES / 10; n++) {
+        const c3ga::Mvec<double> mv1 = randomMvec(), mv2 = randomMvec();
+        const c3ga::OrthogonalMvec<float> orthogonal1((c3ga::Mvec<float>(mv1))), orthogonal2((c3ga::Mvec<float>(mv2)));
+        const double magnitude = largestCoefficient(absoluteValues(mv1) * absoluteValues(mv2));
+        const c3ga::Mvec<float> product = (orthogonal1 * orthogonal2).toMvec(), reference = c3ga::Mvec<float>(mv1) * c3ga::Mvec<float>(mv2);
+        double error = 0.0;
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+            for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+                error = std::max(error, double(std::fabs(product.at(grade, i) - reference.at(grade, i))));
+        check(error < FLOAT_TOLERANCE * std::max(1.0, magnitude), "geometric product in float", n);
+    }
+
+    // e+ and e- square to 1 and -1
+    c3ga::OrthogonalMvec<double> ePlus, eMinus;
+    ePlus[1] = 1.0;
+    eMinus[16] = 1.0;
+    check((ePlus * ePlus).scalar() == 1.0 && (eMinus * eMinus).scalar() == -1.0, "metric of the orthogonal basis");
+
+    if(reportFailures()) return 1;
+    std::cout << "c3ga orthogonal multivectors: every result matches Mvec (largest relative error " << maxError << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <c3ga/Outermorphism.hpp>
+#include <simucore/c3gaTools.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "checkTools.hpp"
+
+
+/* Check that the outermorphism of a motor V (and its batched form) transforms the objects as the sandwich product V * X * ~V */
+
+const int NB_MOTORS = 50; // random motors
+const int NB_OBJECTS = 100; // random objects transformed by each motor
+const double TOLERANCE = 1e-12; // relative to the largest coefficient of the sandwich product
+
+std::uniform_real_distribution<double> coordinate(-10.0, 10.0);
+std::uniform_real_distribution<double> angle(-3.14, 3.14);
+
+/* Largest difference between two multivectors, relative to the largest coefficient of the reference */
+double relativeError(const c3ga::Mvec<double>& mv, const c3ga::Mvec<double>& reference) {
+    double error = 0.0, magnitude = 1.0;
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++) {
+            error = std::max(error, std::fabs(mv.at(grade, i) - reference.at(grade, i)));
+            magnitude = std::max(magnitude, std::fabs(reference.at(grade, i)));
+        }
+    return error / magnitude;
+}
+
+/* Random motor: a rotation around a random axis through the origin, then a random translation */
+c3ga::Mvec<double> randomMotor() {
+    c3ga::Mvec<double> axis = c3ga::e12<double>() * coordinate(generator) + c3ga::e13<double>() * coordinate(generator) + c3ga::e23<double>() * coordinate(generator);
+    axis /= std::sqrt(std::fabs(double(c3ga::Mvec<double>(axis | axis))));
+    const double theta = angle(generator);
+    const c3ga::Mvec<double> rotor = std::cos(0.5 * theta) - axis * std::sin(0.5 * theta);
+    const c3ga::Mvec<double> translation = c3ga::e1<double>() * coordinate(generator) + c3ga::e2<double>() * coordinate(generator) + c3ga::e3<double>() * coordinate(generator);
+    const c3ga::Mvec<double> translator = 1.0 - 0.5 * (translation ^ c3ga::ei<double>());
+    return translator * rotor;
+}
+
+c3ga::Mvec<double> randomPoint() {
+    return c3ga::point<double>(coordinate(generator), coordinate(generator), coordinate(generator));
+}
+
+/* Batched transformation of objects of grade K, against the sandwich product of each one */
+template<unsigned int K>
+void checkBatch(const c3ga::Outermorphism<double>& motion, const c3ga::Mvec<double>& motor, const std::vector<c3ga::Mvec<double>>& objects, int n) {
+    const std::size_t nbObjects = objects.size();
+    std::vector<double> batch(c3ga::binomialArray[K] * nbObjects), batchResult(c3ga::binomialArray[K] * nbObjects);
+    for(std::size_t j=0; j<nbObjects; j++)
+        c3ga::batch::store(c3ga::KVector<double, K>(objects[j]), batch.data(), nbObjects, j);
+    c3ga::batch::transform<K>(motion, batch.data(), batchResult.data(), nbObjects);
+    for(std::size_t j=0; j<nbObjects; j++) {
+        const c3ga::Mvec<double> reference = (motor * objects[j] * motor.reverse()).grade(K);
+        const c3ga::Mvec<double> transformed = c3ga::batch::load<double, K>(batchResult.data(), nbObjects, j).toMvec();
+        check(relativeError(transformed, reference) < TOLERANCE, "batched transformation", n);
+    }
+}
+
+
+int main() {
+    generator.seed(21);
+    for(int n=0; n<NB_MOTORS; n++) {
+        const c3ga::Mvec<double> motor = randomMotor();
+        const c3ga::Mvec<double> motorReverse = motor.reverse();
+        const c3ga::Outermorphism<double> motion(motor);
+
+        std::vector<c3ga::Mvec<double>> points, circles;
+        for(int k=0; k<NB_OBJECTS; k++) {
+            const c3ga::Mvec<double> p = randomPoint(), q = randomPoint(), r = randomPoint();
+            points.push_back(p);
+            circles.push_back(p ^ q ^ r);
+
+            // points, dual spheres, point pairs, circles, lines, planes and a multivector of every grade
+            const c3ga::Mvec<double> objects[] = {
+                p, c3ga::dualSphere<double>(p[c3ga::E1], p[c3ga::E2], p[c3ga::E3], 4.0), p ^ q, p ^ q ^ r, p ^ q ^ c3ga::ei<double>(),
+                p ^ q ^ r ^ c3ga::ei<double>(), 2.0 + p + (q ^ r) + (p ^ q ^ r) + (p ^ q ^ r ^ c3ga::ei<double>()) + c3ga::I<double>()
+            };
+            for(const c3ga::Mvec<double>& object : objects) {
+                const c3ga::Mvec<double> reference = motor * object * motorReverse;
+                check(relativeError(motion(object), reference) < TOLERANCE, "outermorphism", n);
+                c3ga::Mvec<double> transformed = object;
+                motion.apply(transformed, transformed);
+                check(relativeError(transformed, reference) < TOLERANCE, "outermorphism applied in place", n);
+            }
+        }
+        checkBatch<1>(motion, motor, points, n);
+        checkBatch<3>(motion, motor, circles, n);
+
+        // composition, same matrices as the outermorphism of the product of the motors
+        const c3ga::Mvec<double> motor2 = randomMotor();
+        const c3ga::Outermorphism<double> composition = c3ga::Outermorphism<double>(motor2) * motion;
+        const c3ga::Outermorphism<double> product(motor2 * motor);
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+            check((composition.matrix(grade) - product.matrix(grade)).cwiseAbs().maxCoeff() < TOLERANCE * std::max(1.0, product.matrix(grade).cwiseAbs().maxCoeff()), "composition", n);
+    }
+
+    if(reportFailures()) return 1;
+    std::cout << "c3ga outermorphism: every transformation matches the sandwich product" << std::endl;
+    return 0;
+}
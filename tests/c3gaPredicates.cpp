@@ -0,0 +1,128 @@
+#include <simucore/c3gaTools.hpp>
+#include <simucore/c3gaPredicates.hpp>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "checkTools.hpp"
+
+
+/* Check that the predicates of c3gaPredicates.hpp give exactly the values of the Mvec products they replace */
+
+const int NB_CASES = 50000; // random cases of each predicate (4 predicates)
+
+std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+std::uniform_real_distribution<double> length(0.1, 50.0);
+std::uniform_int_distribution<int> integer(-20, 20);
+
+/* Scalar part of a multivector */
+double scalarPart(c3ga::Mvec<double> mv) {
+    return double(mv);
+}
+
+/* Random sphere, one case out of four is tangent to the given one (integer centers and radii, so the tangency is exact) */
+void randomSphere(int n, const double* other, double& x, double& y, double& z, double& r) {
+    if(n % 4 == 3) {
+        const int k = integer(generator);
+        x = other[0] + 3.0 * k; y = other[1] + 4.0 * k; z = other[2];
+        r = std::fabs(5.0 * std::abs(k) - other[3]); // 3-4-5 triangle, the distance of the centers is 5 |k|
+        return;
+    }
+    x = coordinate(generator); y = coordinate(generator); z = coordinate(generator); r = length(generator);
+}
+
+/* Sphere/sphere, sphere/plane, sphere/line and point/sphere against ((a ^ b) | (a ^ b)) and (p | s) with Mvec */
+void checkScalarPredicates() {
+    for(int n=0; n<NB_CASES; n++) {
+        double sphere1[4] = {double(5 * integer(generator)), double(5 * integer(generator)), double(integer(generator)), double(5 + 5 * (n % 7))};
+        if(n % 4 != 3) { sphere1[0] = coordinate(generator); sphere1[1] = coordinate(generator); sphere1[2] = coordinate(generator); sphere1[3] = length(generator); }
+        double sphere2[4];
+        randomSphere(n, sphere1, sphere2[0], sphere2[1], sphere2[2], sphere2[3]);
+
+        const c3ga::Mvec<double> s1 = c3ga::dualSphere<double>(sphere1[0], sphere1[1], sphere1[2], sphere1[3]*sphere1[3]);
+        const c3ga::Mvec<double> s2 = c3ga::dualSphere<double>(sphere2[0], sphere2[1], sphere2[2], sphere2[3]*sphere2[3]);
+        double dualSphere1[5], dualSphere2[5];
+        c3ga::dualSphereCoefficients<double>(sphere1[0], sphere1[1], sphere1[2], sphere1[3]*sphere1[3], dualSphere1);
+        c3ga::dualSphereCoefficients<double>(sphere2[0], sphere2[1], sphere2[2], sphere2[3]*sphere2[3], dualSphere2);
+
+        // sphere/sphere
+        const c3ga::Mvec<double> circle = s1 ^ s2;
+        const double squaredCircle = scalarPart(circle | circle);
+        check(c3ga::squaredOuterVectorVector(dualSphere1, dualSphere2) == squaredCircle, "sphere/sphere squared meet", n);
+        check(c3ga::dualSpheresIntersect(dualSphere1, dualSphere2) == (squaredCircle < 0.0), "sphere/sphere predicate", n);
+
+        // sphere/plane
+        const double normalX = coordinate(generator), normalY = coordinate(generator), normalZ = coordinate(generator);
+        const double norm = std::sqrt(normalX*normalX + normalY*normalY + normalZ*normalZ);
+        const double distance = coordinate(generator);
+        c3ga::Mvec<double> plane;
+        plane[c3ga::E1] = normalX / norm; plane[c3ga::E2] = normalY / norm; plane[c3ga::E3] = normalZ / norm; plane[c3ga::Ei] = distance;
+        double dualPlane[5];
+        c3ga::dualPlaneCoefficients<double>(normalX / norm, normalY / norm, normalZ / norm, distance, dualPlane);
+        const c3ga::Mvec<double> planeCircle = s1 ^ plane;
+        check(c3ga::dualSphereIntersectsDualPlane(dualSphere1, dualPlane) == (scalarPart(planeCircle | planeCircle) < 0.0), "sphere/plane predicate", n);
+
+        // sphere/line, the dual of the line through two points
+        const c3ga::Mvec<double> line = (c3ga::point<double>(coordinate(generator), coordinate(generator), coordinate(generator))
+                                       ^ c3ga::point<double>(coordinate(generator), coordinate(generator), coordinate(generator))
+                                       ^ c3ga::ei<double>()).dual();
+        double dualLine[10];
+        c3ga::bivectorCoefficients(line, dualLine);
+        const c3ga::Mvec<double> pairPoint = s1 ^ line;
+        const double squaredPairPoint = scalarPart(pairPoint | pairPoint);
+        check(c3ga::squaredOuterVectorBivector(dualSphere1, dualLine) == squaredPairPoint, "sphere/line squared meet", n);
+        check(c3ga::dualSphereIntersectsDualLine(dualSphere1, dualLine) == (squaredPairPoint < 0.0), "sphere/line predicate", n);
+
+        // point/sphere
+        const c3ga::Mvec<double> p = c3ga::point<double>(sphere2[0], sphere2[1], sphere2[2]);
+        double point[5];
+        c3ga::pointCoefficients<double>(sphere2[0], sphere2[1], sphere2[2], point);
+        check(c3ga::pointInDualSphere(point, dualSphere1) == (scalarPart(p | s1) > 0.0), "point/sphere predicate", n);
+    }
+}
+
+/* The batched forms against the scalar ones, and the float filter against the double predicate */
+void checkBatchedPredicates() {
+    const int nbSpheres = 1000;
+    std::vector<float> centerX(nbSpheres), centerY(nbSpheres), centerZ(nbSpheres), radius(nbSpheres), errorScales(nbSpheres);
+    for(int j=0; j<nbSpheres; j++) {
+        // a few spheres are copies, or tangent to the previous one
+        if(j % 5 == 4) { centerX[j] = centerX[j-1] + 3.0f; centerY[j] = centerY[j-1] + 4.0f; centerZ[j] = centerZ[j-1]; radius[j] = std::fabs(5.0f - radius[j-1]); continue; }
+        centerX[j] = coordinate(generator); centerY[j] = coordinate(generator); centerZ[j] = coordinate(generator);
+        radius[j] = 0.5 + length(generator) / 10.0;
+    }
+
+    std::vector<double> vectors(5 * nbSpheres), exactVectors(5 * nbSpheres);
+    for(int j=0; j<nbSpheres; j++)
+        c3ga::dualSphereCoefficients<double>(centerX[j], centerY[j], centerZ[j], double(radius[j]) * double(radius[j]), vectors.data() + 5*j);
+    c3ga::batch::dualSpheres(centerX.data(), centerY.data(), centerZ.data(), radius.data(), nbSpheres, exactVectors.data());
+    c3ga::batch::dualSphereErrorScales(centerX.data(), centerY.data(), centerZ.data(), radius.data(), nbSpheres, errorScales.data());
+
+    std::vector<std::pair<int,int>> pairs;
+    for(int j=1; j<nbSpheres; j++)
+        for(int k=std::max(0, j - 60); k<j; k++)
+            pairs.emplace_back(k, j);
+    std::vector<uint8_t> arrays(pairs.size()), structures(pairs.size()), filtered(pairs.size());
+    c3ga::dualSpheresIntersect(vectors.data(), pairs.data(), pairs.size(), arrays.data());
+    c3ga::batch::dualSpheresIntersect(exactVectors.data(), nbSpheres, pairs.data(), pairs.size(), structures.data());
+    c3ga::batch::dualSpheresIntersectFiltered(centerX.data(), centerY.data(), centerZ.data(), radius.data(), errorScales.data(),
+                                              exactVectors.data(), nbSpheres, pairs.data(), pairs.size(), filtered.data());
+    for(std::size_t p=0; p<pairs.size(); p++) {
+        const bool expected = c3ga::dualSpheresIntersect(vectors.data() + 5*pairs[p].first, vectors.data() + 5*pairs[p].second);
+        check(arrays[p] == expected, "batched sphere/sphere predicate", int(p));
+        check(structures[p] == expected, "sphere/sphere predicate on structures of arrays", int(p));
+        check(filtered[p] == expected, "filtered sphere/sphere predicate", int(p));
+    }
+}
+
+
+int main() {
+    generator.seed(42);
+    checkScalarPredicates();
+    checkBatchedPredicates();
+    if(reportFailures()) return 1;
+    std::cout << "c3ga predicates: every result matches Mvec" << std::endl;
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <c3ga/Serialization.hpp>
+#include <simucore/c3gaTools.hpp>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "checkTools.hpp"
+
+
+/* Check that MvecReader reads back exactly the multivectors written by MvecWriter, in a buffer or a stream, in double or
+ * in float, and that a truncated or invalid sequence is reported by good() */
+
+const int NB_MULTIVECTORS = 5000; // random multivectors, a few blocks of serializationBlockSize bytes
+
+std::uniform_real_distribution<double> coefficient(-1000.0, 1000.0);
+
+/* Random multivector of random grades (possibly none), with a few special coefficients */
+c3ga::Mvec<double> randomMvec() {
+    const double specialValues[] = {0.0, -0.0, 1e-310, -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::max(), 0.1};
+    const unsigned int grades = generator() % 64;
+    return randomMvec(grades, [&]{ return generator() % 8 == 0 ? specialValues[generator() % 6] : coefficient(generator); });
+}
+
+/* Same grades and same bits of the coefficients (so -0 differs from +0) */
+template<typename T>
+bool identical(const c3ga::Mvec<T>& mv1, const c3ga::Mvec<T>& mv2) {
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++) {
+        if(mv1.isGrade(grade) != mv2.isGrade(grade)) return false;
+        if(!mv1.isGrade(grade)) continue;
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++) {
+            const T coefficient1 = mv1.at(grade, i), coefficient2 = mv2.at(grade, i);
+            if(std::memcmp(&coefficient1, &coefficient2, sizeof(T)) != 0) return false;
+        }
+    }
+    return true;
+}
+
+/* Expected number of bytes of the sequence: the header, then the grade bitmap and the coefficients of each multivector
+ * (an empty multivector has no coefficient, although isGrade(0) is true) */
+std::size_t expectedSize(const std::vector<c3ga::Mvec<double>>& mvs, std::size_t coefficientSize) {
+    std::size_t size = c3ga::serializationHeaderSize;
+    for(const c3ga::Mvec<double>& mv : mvs) {
+        size++;
+        for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+            if(!mv.isEmpty() && mv.isGrade(grade)) size += c3ga::binomialArray[grade] * coefficientSize;
+    }
+    return size;
+}
+
+/* Read the whole sequence, one multivector at a time in the same Mvec, and compare it with the written multivectors
+ * converted to T (the values stored in float are the float roundings) */
+template<typename T, typename Stored>
+void checkSequence(c3ga::MvecReader& reader, const std::vector<c3ga::Mvec<double>>& mvs, const char* what) {
+    check(reader.good() && reader.isFloat() == (sizeof(Stored) == sizeof(float)), what);
+    c3ga::Mvec<T> mv;
+    int nbRead = 0;
+    while(reader.read(mv)) {
+        if(nbRead < NB_MULTIVECTORS) check(identical(mv, c3ga::Mvec<T>(c3ga::Mvec<Stored>(mvs[nbRead]))), what, nbRead);
+        nbRead++;
+    }
+    check(nbRead == NB_MULTIVECTORS && reader.good(), what, nbRead);
+}
+
+/* Round trips in a buffer and in a stream, with the coefficients stored in Stored */
+template<typename Stored>
+void checkRoundTrips(const std::vector<c3ga::Mvec<double>>& mvs, const char* what) {
+    std::vector<unsigned char> buffer;
+    std::ostringstream output(std::ios::binary);
+    {
+        c3ga::MvecWriter<Stored> bufferWriter(buffer);
+        bufferWriter.write(mvs.data(), mvs.size());
+        c3ga::MvecWriter<Stored> streamWriter(output);
+        for(const c3ga::Mvec<double>& mv : mvs) streamWriter.write(mv);
+        check(bufferWriter.count() == mvs.size() && streamWriter.count() == mvs.size(), what);
+    } // the writers flush when they are destroyed
+    const std::string bytes = output.str();
+    check(buffer.size() == expectedSize(mvs, sizeof(Stored)) && bytes.size() == buffer.size()
+          && std::memcmp(bytes.data(), buffer.data(), buffer.size()) == 0, what);
+
+    c3ga::MvecReader bufferReader(buffer.data(), buffer.size());
+    checkSequence<double, Stored>(bufferReader, mvs, what);
+    c3ga::MvecReader floatReader(buffer.data(), buffer.size());
+    checkSequence<float, Stored>(floatReader, mvs, what);
+    std::istringstream input(bytes, std::ios::binary);
+    c3ga::MvecReader streamReader(input);
+    checkSequence<double, Stored>(streamReader, mvs, what);
+
+    // the array form stops at the end of the sequence
+    std::vector<c3ga::Mvec<double>> readMvs(mvs.size() + 10);
+    c3ga::MvecReader arrayReader(buffer.data(), buffer.size());
+    check(arrayReader.read(readMvs.data(), readMvs.size()) == mvs.size() && arrayReader.good(), what);
+
+    // a stream cut in the middle of the last multivector: the others are read, then good() is false
+    std::size_t lastSize = 1;
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        if(mvs.back().isGrade(grade)) lastSize += c3ga::binomialArray[grade] * sizeof(Stored);
+    std::istringstream truncated(bytes.substr(0, bytes.size() - lastSize / 2 - 1), std::ios::binary);
+    c3ga::MvecReader truncatedReader(truncated);
+    check(truncatedReader.read(readMvs.data(), readMvs.size()) == mvs.size() - 1 && !truncatedReader.good(), "truncated stream");
+}
+
+
+int main() {
+    generator.seed(25);
+    std::vector<c3ga::Mvec<double>> mvs;
+    for(int n=0; n<NB_MULTIVECTORS; n++)
+        mvs.push_back(randomMvec());
+    mvs.back() = c3ga::Mvec<double>(); // the last one has every grade, so it can be truncated
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+            mvs.back().at(grade, i) = coefficient(generator);
+
+    checkRoundTrips<double>(mvs, "round trip in double");
+    checkRoundTrips<float>(mvs, "round trip in float");
+
+    // a dual sphere takes 41 bytes in double, 21 in float
+    std::vector<unsigned char> doubleBuffer, floatBuffer;
+    {
+        c3ga::MvecWriter<double> doubleWriter(doubleBuffer);
+        c3ga::MvecWriter<float> floatWriter(floatBuffer);
+        doubleWriter.write(c3ga::dualSphere<double>(1.0, 2.0, 3.0, 4.0));
+        floatWriter.write(c3ga::dualSphere<double>(1.0, 2.0, 3.0, 4.0));
+    }
+    check(doubleBuffer.size() == c3ga::serializationHeaderSize + 41 && floatBuffer.size() == c3ga::serializationHeaderSize + 21, "size of a dual sphere");
+
+    // invalid sequences: a stream cut in its header, another header, a grade out of the algebra
+    c3ga::Mvec<double> mv = mvs.front();
+    std::istringstream header(std::string(reinterpret_cast<const char*>(doubleBuffer.data()), 5), std::ios::binary);
+    c3ga::MvecReader headerReader(header);
+    check(!headerReader.good() && !headerReader.read(mv), "truncated header");
+    const unsigned char junk[9] = {'C', '3', 'G', 'B', 1, 8, 0, 0, 0};
+    c3ga::MvecReader junkReader(junk, sizeof(junk));
+    check(!junkReader.good() && !junkReader.read(mv), "invalid header");
+    doubleBuffer[c3ga::serializationHeaderSize] = 1 << (c3ga::algebraDimension + 1);
+    c3ga::MvecReader gradeReader(doubleBuffer.data(), doubleBuffer.size());
+    check(!gradeReader.read(mv) && !gradeReader.good(), "invalid grade bitmap");
+    check(identical(mv, mvs.front()), "multivector unchanged by a failed read");
+
+    if(reportFailures()) return 1;
+    std::cout << "c3ga serialization: every multivector is read back as written" << std::endl;
+    return 0;
+}
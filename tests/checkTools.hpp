@@ -0,0 +1,58 @@
+#pragma once
+
+#include <c3ga/Mvec.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+
+/* Tools shared by the checks: one random generator, the count of the failures and their report.
+ * Each check seeds the generator with its own number at the start of main, so its cases do not change
+ * when another check changes. */
+
+inline std::mt19937_64 generator;
+
+inline int nbFailures = 0;
+
+/* Count and report a failing case (the first ten only), n < 0 if the check is not about one case */
+inline void check(bool condition, const char* what, int n = -1) {
+    if(condition) return;
+    if(nbFailures < 10) {
+        std::cerr << "FAILED " << what;
+        if(n >= 0) std::cerr << " (case " << n << ")";
+        std::cerr << std::endl;
+    }
+    nbFailures++;
+}
+
+/* Print the number of failures, return true if there is any (main then returns 1) */
+inline bool reportFailures() {
+    if(nbFailures == 0) return false;
+    std::cerr << nbFailures << " failures" << std::endl;
+    return true;
+}
+
+/* Running FNV-1a hash of the results of a check, to compare long sequences of results */
+struct Digest {
+    uint64_t value = 14695981039346656037ull;
+
+    void add(const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for(std::size_t i=0; i<size; i++) {
+            value ^= bytes[i];
+            value *= 1099511628211ull;
+        }
+    }
+};
+
+/* Multivector of the given grades (bit k set for the grade k), its coefficients drawn one by one by draw() */
+template<typename Draw>
+c3ga::Mvec<double> randomMvec(unsigned int grades, Draw draw) {
+    c3ga::Mvec<double> mv;
+    for(unsigned int grade=0; grade<=c3ga::algebraDimension; grade++)
+        if(grades & (1 << grade))
+            for(unsigned int i=0; i<c3ga::binomialArray[grade]; i++)
+                mv.at(grade, i) = draw();
+    return mv;
+}
@@ -0,0 +1,107 @@
+#include <simucore/Simulation.hpp>
+#include <simucore/SpatialGrid.hpp>
+#include <simucore/SweepAndPrune.hpp>
+#include <simucore/DynamicTree.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "checkTools.hpp"
+
+
+/* Check that the broad phases find every colliding pair, exactly the ones of BruteForce, over the steps of a simulation
+ * where planets are also added and removed between the steps */
+
+const int NB_PLANETS = 100;
+const int NB_STEPS = 3000;
+
+/* Colliding pairs among the candidate pairs of a broad phase, which must be sorted pairs (i, j) with i < j < n */
+std::vector<CandidatePair> collidingPairs(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs, const char* name, int step) {
+    std::vector<CandidatePair> colliding;
+    for(std::size_t p=0; p<pairs.size(); p++) {
+        const int i = pairs[p].first, j = pairs[p].second;
+        check(0 <= i && i < j && std::size_t(j) < planets.size() && (p == 0 || pairs[p-1] < pairs[p]), name, step);
+        if(0 <= i && i < j && std::size_t(j) < planets.size() && planets.hasCollided(i, j)) colliding.push_back(pairs[p]);
+    }
+    return colliding;
+}
+
+/* Pairs of planets whose boxes (center +- radius) overlap or touch, as the sweep and prune keeps them */
+std::vector<CandidatePair> overlappingBoxes(const PlanetSystem& planets, const std::vector<CandidatePair>& pairs) {
+    std::vector<CandidatePair> overlapping;
+    for(const CandidatePair& pair : pairs) {
+        bool overlap = true;
+        for(const AlignedVector<float>* position : {&planets.posX, &planets.posY, &planets.posZ}) {
+            const float a = (*position)[pair.first], b = (*position)[pair.second];
+            const float sizeA = planets.sizes[pair.first], sizeB = planets.sizes[pair.second];
+            if(a - sizeA > b + sizeB || b - sizeB > a + sizeA) overlap = false;
+        }
+        if(overlap) overlapping.push_back(pair);
+    }
+    return overlapping;
+}
+
+/* Remove a few random planets, and add planets at random places or on top of other planets */
+void addAndRemovePlanets(PlanetSystem& planets, Info& info) {
+    std::vector<uint8_t> removed(planets.size(), 0);
+    for(std::size_t i=0; i<planets.size(); i++)
+        removed[i] = (generator() % 16 == 0);
+    planets.remove(removed);
+    const int nbAdded = int(generator() % 4);
+    for(int n=0; n<nbAdded; n++) {
+        if(planets.empty() || generator() % 2 == 0) planets.add(createPlanet(&info));
+        else planets.add(createPlanet(&info, 1 + int(generator() % 4), planets.position(generator() % planets.size())));
+    }
+}
+
+
+int main() {
+    generator.seed(2);
+    VirtualClock clock;
+    Info info(&clock);
+    info.setSeed(2);
+    info.modifyLogEvents();
+    BruteForce bruteForce;
+    NarrowPhase narrowPhase(1);
+    PlanetSystem planets = createAllPlanets(NB_PLANETS, &info);
+    ParticleSystem explosions;
+    UpdateBuffers buffers;
+
+    SpatialGrid grid;
+    SweepAndPrune sweepAndPrune; // incremental, the planets added and removed between the steps are found by their ids
+    DynamicTree dynamicTree; // incremental too, the leaves are refitted and the tree rotated as the planets move
+    const std::pair<const char*, BroadPhase*> broadPhases[] = {{"grid", &grid}, {"sweep and prune", &sweepAndPrune}, {"dynamic tree", &dynamicTree}};
+
+    std::vector<CandidatePair> pairs;
+    long long nbColliding = 0;
+    for(int step=0; step<NB_STEPS; step++) {
+        updateVisibility(&planets, info);
+        updateEverything(&planets, &explosions, &info, &bruteForce, &narrowPhase, &buffers);
+        clock.advance(1.0 / 60.0);
+        if(step % 3 == 0) addAndRemovePlanets(planets, info);
+
+        bruteForce.findPairs(planets, pairs);
+        const std::vector<CandidatePair> reference = collidingPairs(planets, pairs, "brute force", step);
+        const std::vector<CandidatePair> boxes = overlappingBoxes(planets, pairs);
+        nbColliding += reference.size();
+        for(const auto& broadPhase : broadPhases) {
+            broadPhase.second->findPairs(planets, pairs);
+            check(collidingPairs(planets, pairs, broadPhase.first, step) == reference, broadPhase.first, step);
+            // the sweep and prune gives no other pair, a pair kept after its boxes separate would only be seen here
+            if(broadPhase.second == &sweepAndPrune) check(pairs == boxes, "overlapping boxes of the sweep and prune", step);
+            // the fattened boxes of the tree contain the boxes of the planets, so it finds at least their overlaps
+            if(broadPhase.second == &dynamicTree) check(std::includes(pairs.begin(), pairs.end(), boxes.begin(), boxes.end()), "overlapping boxes of the dynamic tree", step);
+        }
+        // balanced by the rotations, an AVL tree of n leaves (2n - 1 nodes) is less than 1.45 log2(2n + 1) high
+        check(dynamicTree.getHeight() <= int(1.45 * std::log2(2.0 * planets.size() + 1.0)), "height of the dynamic tree", step);
+    }
+    check(nbColliding > 0, "colliding pairs during the run");
+
+    if(reportFailures()) return 1;
+    std::cout << "simulation broad phases: every broad phase finds the " << nbColliding << " colliding pairs of the brute force" << std::endl;
+    return 0;
+}
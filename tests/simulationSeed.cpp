@@ -0,0 +1,86 @@
+#include <simucore/Simulation.hpp>
+#include <simucore/DynamicTree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "checkTools.hpp"
+
+
+/* Check that a simulation is reproduced from its seed: two runs with the same seed in the same process give the same
+ * planets and particles at every step, whatever the number of threads of the narrow phase */
+
+const int NB_PLANETS = 30;
+const int NB_STEPS = 1500;
+const uint64_t SEED = 42;
+
+/* Add the state of the planets and of the particles to a digest */
+void addState(Digest& digest, const PlanetSystem& planets, const ParticleSystem& explosions) {
+    const std::size_t n = planets.size(), m = explosions.size();
+    digest.add(&n, sizeof(n));
+    digest.add(planets.ids.data(), n * sizeof(unsigned int));
+    for(const AlignedVector<float>* field : {&planets.posX, &planets.posY, &planets.posZ, &planets.dirX, &planets.dirY, &planets.dirZ, &planets.sizes})
+        digest.add(field->data(), n * sizeof(float));
+    digest.add(planets.loaded.data(), n);
+    digest.add(&m, sizeof(m));
+    for(const AlignedVector<float>* field : {&explosions.posX, &explosions.posY, &explosions.posZ, &explosions.sizes})
+        digest.add(field->data(), m * sizeof(float));
+}
+
+/* Run a simulation as the headless runner does, with a spawn and a clean from time to time, and return the digest of
+ * the state after each step (the number of collisions of the run in nbCollisions) */
+std::vector<uint64_t> run(uint64_t seed, int nbThreads, long long& nbCollisions) {
+    VirtualClock clock;
+    Info info(&clock);
+    info.setSeed(seed);
+    info.modifyLogEvents();
+    DynamicTree broadPhase;
+    NarrowPhase narrowPhase(nbThreads);
+    PlanetSystem planets = createAllPlanets(NB_PLANETS, &info);
+    ParticleSystem explosions;
+    UpdateBuffers buffers;
+
+    std::vector<uint64_t> digests;
+    nbCollisions = 0;
+    for(int step=0; step<NB_STEPS; step++) {
+        if(step % 100 == 50) info.modifySpecialSpawn();
+        if(step % 500 == 499) info.modifySpecialClean();
+        updateVisibility(&planets, info);
+        nbCollisions += updateEverything(&planets, &explosions, &info, &broadPhase, &narrowPhase, &buffers);
+        clock.advance(1.0 / 60.0);
+        Digest digest;
+        addState(digest, planets, explosions);
+        digests.push_back(digest.value);
+    }
+    return digests;
+}
+
+/* Index of the first step where two runs differ, -1 if they are the same */
+int firstDifference(const std::vector<uint64_t>& digests1, const std::vector<uint64_t>& digests2) {
+    for(std::size_t step=0; step<digests1.size(); step++)
+        if(step >= digests2.size() || digests1[step] != digests2[step]) return int(step);
+    return -1;
+}
+
+
+int main() {
+    long long nbCollisions, nbCollisionsAgain, nbCollisionsThreads, nbCollisionsOther;
+    const std::vector<uint64_t> reference = run(SEED, 1, nbCollisions);
+    check(nbCollisions > 0, "collisions during the run");
+
+    // the second simulation of the process starts again from the planet id 0
+    const std::vector<uint64_t> again = run(SEED, 1, nbCollisionsAgain);
+    check(firstDifference(reference, again) == -1 && nbCollisionsAgain == nbCollisions, "same seed, second run", firstDifference(reference, again));
+
+    // the pairs are tested concurrently, but the hits are merged in the order of the pairs
+    const std::vector<uint64_t> threads = run(SEED, 4, nbCollisionsThreads);
+    check(firstDifference(reference, threads) == -1 && nbCollisionsThreads == nbCollisions, "same seed, 4 threads", firstDifference(reference, threads));
+
+    // another seed gives another simulation, so the digests do see the differences
+    const std::vector<uint64_t> other = run(SEED + 1, 1, nbCollisionsOther);
+    check(firstDifference(reference, other) != -1, "another seed");
+
+    if(reportFailures()) return 1;
+    std::cout << "simulation seed: the runs with the same seed are the same at every step (" << nbCollisions << " collisions)" << std::endl;
+    return 0;
+}